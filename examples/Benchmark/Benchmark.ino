@@ -0,0 +1,444 @@
+/*
+ * Benchmark
+ *
+ * Speed and accuracy report for every mapper, table and filter:
+ *   - ns/sample through apply() and through applyBlock()
+ *   - mappers/tables: max |T - T_ref| in °C against the forward
+ *     Callendar–Van Dusen model evaluated in double precision (NTC:
+ *     Steinhart–Hart in double, type K: NIST forward polynomial)
+ *   - filters: max difference between apply() and applyBlock() in ulp
+ *     (both paths run the same recurrence and must stay bit-identical)
+ *   - low-pass DC rows: |y - 20| after a primed step 10 → 20 has settled,
+ *     and over a long run of a primed constant 20 (state rounding drift)
+ *   - decimators: misplaced or missing outputs (expected on inputs 0, R,
+ *     2R, …) through apply() and applyBlock(), and the settled DC value
+ *
+ * Every row is checked against an error budget and printed as PASS/FAIL,
+ * so the sketch can be run on each target before a fleet update.
+ *
+ * Timing uses CycleCounter: DWT CYCCNT on Cortex-M (STM32), the CPU cycle
+ * counter on ESP32, micros() elsewhere. Build with the release flags of the
+ * firmware (e.g. -O2 -fno-math-errno -fno-trapping-math) to get its numbers.
+ */
+
+#include <Arduino.h>
+#include <string.h>
+#include "CycleCounter.h"
+#include "RTD_385.h"
+#include "NTCSteinhartHart.h"
+#include "ThermocoupleTypeK.h"
+#include "PiecewiseLinearTable.h"
+#include "CubicHermiteMonotonicSplineTable.h"
+#include "CubicSplineTable.h"
+#include "LookupTableMapper.h"
+#include "EMAFilter.h"
+#include "AdaptiveAbsoluteEMAFilter.h"
+#include "AlphaBetaFilter.h"
+#include "KalmanFilter.h"
+#include "KalmanCVFilter.h"
+#include "Median3Filter.h"
+#include "SMAFilter.h"
+#include "RunningMedianFilter.h"
+#include "MovingMinMaxFilter.h"
+#include "BiquadCascadeFilter.h"
+#include "CICDecimatorFilter.h"
+#include "HalfBandDecimatorFilter.h"
+
+static const size_t N = 256;
+static const uint16_t ROUNDS = 20;
+
+static float in[N];
+static float ref[N];
+static float outScalar[N];
+static float outBlock[N];
+
+static uint16_t failures = 0;
+
+// ---- Reference model ----
+
+// IEC 60751 forward CVD equation R(T), α = 0.00385
+static double cvdResistance(double T, double r0)
+{
+    const double A = 3.9083e-3;
+    const double B = -5.775e-7;
+    const double C = (T < 0.0) ? -4.183e-12 : 0.0;
+
+    return r0 * (1.0 + A * T + B * T * T + C * (T - 100.0) * T * T * T);
+}
+
+// Fill in[] with Pt100 resistances for T uniformly spaced over [tMin, tMax], ref[] with T
+static void sweepTemperature(float tMin, float tMax)
+{
+    for (size_t i = 0; i < N; i++)
+    {
+        double T = tMin + (static_cast<double>(tMax) - tMin) * i / (N - 1);
+
+        in[i] = static_cast<float>(cvdResistance(T, 100.0));
+        ref[i] = static_cast<float>(T);
+    }
+}
+
+// Fill in[] with NTC resistances log-spaced over [rMin, rMax], ref[] with the Steinhart–Hart T
+static void sweepNtc(double rMin, double rMax, double a, double b, double c)
+{
+    for (size_t i = 0; i < N; i++)
+    {
+        double R = rMin * pow(rMax / rMin, static_cast<double>(i) / (N - 1));
+        double L = log(static_cast<double>(static_cast<float>(R)));
+
+        in[i] = static_cast<float>(R);
+        ref[i] = static_cast<float>(1.0 / (a + b * L + c * L * L * L) - 273.15);
+    }
+}
+
+// Fill in[] with type K voltages (mV, 0 °C reference) for T over [tMin, tMax], ref[] with T
+static void sweepTypeK(float tMin, float tMax)
+{
+    for (size_t i = 0; i < N; i++)
+    {
+        double T = tMin + (static_cast<double>(tMax) - tMin) * i / (N - 1);
+
+        in[i] = static_cast<float>(ThermocoupleTypeK::forward(T));
+        ref[i] = static_cast<float>(T);
+    }
+}
+
+// Deterministic noisy signal around 25.0 for the filters
+static void noisySignal()
+{
+    uint32_t lcg = 12345;
+
+    for (size_t i = 0; i < N; i++)
+    {
+        lcg = lcg * 1664525UL + 1013904223UL;
+        float noise = static_cast<float>(lcg >> 8) / 16777216.0f - 0.5f;
+
+        in[i] = 25.0f + 2.0f * sinf(0.05f * i) + noise;
+    }
+}
+
+static int32_t ulpDistance(float a, float b)
+{
+    int32_t ia, ib;
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+
+    // Map sign-magnitude to a monotonic integer line
+    if (ia < 0) { ia = INT32_MIN - ia; }
+    if (ib < 0) { ib = INT32_MIN - ib; }
+
+    int32_t d = ia - ib;
+    return (d < 0) ? -d : d;
+}
+
+// ---- Timing ----
+
+static float nsPerSampleApply(BaseMeasurementProcessor &proc)
+{
+    uint32_t t0 = CycleCounter::now();
+
+    for (uint16_t k = 0; k < ROUNDS; k++)
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            outScalar[i] = proc.apply(in[i]);
+        }
+    }
+
+    return CycleCounter::toNs(CycleCounter::elapsed(t0)) / (static_cast<float>(N) * ROUNDS);
+}
+
+static float nsPerSampleBlock(BaseMeasurementProcessor &proc)
+{
+    uint32_t t0 = CycleCounter::now();
+
+    for (uint16_t k = 0; k < ROUNDS; k++)
+    {
+        proc.applyBlock(in, outBlock, N);
+    }
+
+    return CycleCounter::toNs(CycleCounter::elapsed(t0)) / (static_cast<float>(N) * ROUNDS);
+}
+
+// ---- Report ----
+
+static void printPadded(const char *s, uint8_t width)
+{
+    Serial.print(s);
+
+    for (size_t i = strlen(s); i < width; i++)
+    {
+        Serial.print(" ");
+    }
+}
+
+static void printRow(const char *name, float nsApply, float nsBlock, float err, int digits, float limit)
+{
+    bool ok = err <= limit;
+
+    if (!ok)
+    {
+        failures++;
+    }
+
+    printPadded(name, 36);
+    Serial.print(nsApply, 1);
+    Serial.print("\t");
+    Serial.print(nsBlock, 1);
+    Serial.print("\t");
+    Serial.print(err, digits);
+    Serial.print("\t");
+    Serial.print(limit, digits);
+    Serial.print("\t");
+    Serial.println(ok ? "PASS" : "FAIL");
+}
+
+// Mapper over the sweep currently in in[]/ref[]; error in °C
+static void benchMapper(const char *name, BaseMeasurementProcessor &proc, float limit)
+{
+    float nsApply = nsPerSampleApply(proc);
+    float nsBlock = nsPerSampleBlock(proc);
+
+    float err = 0.0f;
+
+    for (size_t i = 0; i < N; i++)
+    {
+        float e = fabsf(outScalar[i] - ref[i]);
+        float eb = fabsf(outBlock[i] - ref[i]);
+
+        if (e > err) { err = e; }
+        if (eb > err) { err = eb; }
+    }
+
+    printRow(name, nsApply, nsBlock, err, 6, limit);
+}
+
+// Filter over the noisy signal; scalar and block path start from identical copies
+template <class Filter>
+static void benchFilter(const char *name, const Filter &prototype)
+{
+    Filter scalar = prototype;
+    Filter block = prototype;
+
+    float nsApply = nsPerSampleApply(scalar);
+    float nsBlock = nsPerSampleBlock(block);
+
+    // Fresh copies for the comparison, timing rounds above advanced the state
+    scalar = prototype;
+    block = prototype;
+
+    int32_t maxUlp = 0;
+
+    block.applyBlock(in, outBlock, N);
+
+    for (size_t i = 0; i < N; i++)
+    {
+        int32_t d = ulpDistance(scalar.apply(in[i]), outBlock[i]);
+        if (d > maxUlp) { maxUlp = d; }
+    }
+
+    printRow(name, nsApply, nsBlock, static_cast<float>(maxUlp), 0, 0.0f);
+}
+
+// Low-pass DC accuracy: primed step 10 → 20 read after settle samples, then
+// the worst |y - 20| of a primed constant 20 over hold samples
+template <class Filter>
+static void benchDcSettling(const char *name, const Filter &prototype, uint32_t settle, uint32_t hold, float limit)
+{
+    Filter scalar = prototype;
+    Filter block = prototype;
+
+    float nsApply = nsPerSampleApply(scalar);
+    float nsBlock = nsPerSampleBlock(block);
+
+    Filter stepped = prototype;
+    float y = stepped.apply(10.0f);
+
+    for (uint32_t i = 0; i < settle; i++)
+    {
+        y = stepped.apply(20.0f);
+    }
+
+    float err = fabsf(y - 20.0f);
+    Filter held = prototype;
+
+    for (uint32_t i = 0; i < hold; i++)
+    {
+        float e = fabsf(held.apply(20.0f) - 20.0f);
+        if (e > err) { err = e; }
+    }
+
+    printRow(name, nsApply, nsBlock, err, 6, limit);
+}
+
+// Decimator by ratio: outputs must come on inputs 0, ratio, 2·ratio, … through
+// apply() and applyBlock() alike; DC row: |y - 20| after a primed step 10 → 20
+template <class Filter>
+static void benchDecimator(const char *name, const char *dcName, const Filter &prototype, uint32_t ratio)
+{
+    Filter scalar = prototype;
+    Filter block = prototype;
+
+    float nsApply = nsPerSampleApply(scalar);
+    float nsBlock = nsPerSampleBlock(block);
+
+    scalar = prototype;
+    block = prototype;
+
+    uint32_t misplaced = 0;
+    size_t count = 0;
+
+    for (size_t i = 0; i < N; i++)
+    {
+        float y = scalar.apply(in[i]);
+        bool expected = (i % ratio) == 0;
+
+        if (scalar.outputReady() != expected)
+        {
+            misplaced++;
+        }
+
+        if (scalar.outputReady() && count < N)
+        {
+            outScalar[count++] = y;
+        }
+    }
+
+    size_t emitted = block.applyBlock(in, outBlock, N);
+
+    if (emitted != count || count != (N + ratio - 1) / ratio)
+    {
+        misplaced++;
+    }
+
+    for (size_t i = 0; i < count && i < emitted; i++)
+    {
+        if (outBlock[i] != outScalar[i])
+        {
+            misplaced++;
+        }
+    }
+
+    printRow(name, nsApply, nsBlock, static_cast<float>(misplaced), 0, 0.0f);
+
+    Filter stepped = prototype;
+    float y = stepped.apply(10.0f);
+
+    for (uint32_t i = 0; i < 64 * ratio; i++)
+    {
+        y = stepped.apply(20.0f);
+    }
+
+    printRow(dcName, nsApply, nsBlock, fabsf(y - 20.0f), 6, 0.00001f);
+}
+
+// Eight-point calibration table of RTD385 over −50 … +120 °C
+static void fillTable(BaseTableProcessor &table)
+{
+    static const float T_POINTS[8] = {-50.0f, -25.0f, 0.0f, 25.0f, 50.0f, 75.0f, 100.0f, 120.0f};
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        table.pushPoint(static_cast<float>(cvdResistance(T_POINTS[i], 100.0)), T_POINTS[i]);
+    }
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(1000);
+
+    CycleCounter::begin();
+
+    Serial.print("timer: ");
+    Serial.println(CycleCounter::HAS_CYCLES ? "cpu cycles" : "micros()");
+    Serial.println("processor                           apply ns\tblock ns\tmax err\tlimit\tresult");
+
+    // ---- Mappers against the CVD model ----
+    // Limits: fit error of the polynomial plus float rounding of R and T
+
+    RTD385 rtd(100.0f);
+    sweepTemperature(-200.0f, 661.0f);
+    benchMapper("RTD385 [-200, 661] C", rtd, 0.002f);
+
+    RTD385Segmented rtdSegmented(100.0f);
+    sweepTemperature(-200.0f, 850.0f);
+    benchMapper("RTD385Segmented [-200, 850] C", rtdSegmented, 0.0005f);
+
+    RTD385_5C45C_PT100 rtdNarrow;
+    sweepTemperature(5.0f, 45.0f);
+    benchMapper("RTD385_5C45C_PT100 [5, 45] C", rtdNarrow, 0.0002f);
+
+    NTCSteinhartHart ntc(1.129148e-3f, 2.34125e-4f, 8.76741e-8f);
+    sweepNtc(100.0, 100000.0, 1.129148e-3, 2.34125e-4, 8.76741e-8);
+    benchMapper("NTCSteinhartHart 10k [-20, 178] C", ntc, 0.001f);
+
+    ThermocoupleTypeK typeK;
+    sweepTypeK(-200.0f, 1372.0f);
+    benchMapper("ThermocoupleTypeK [-200, 1372] C", typeK, 0.06f);
+
+    RTD385_N50C120C_PT100 rtdWide;
+    sweepTemperature(-50.0f, 120.0f);
+    benchMapper("RTD385_N50C120C_PT100 [-50, 120] C", rtdWide, 0.002f);
+
+    // ---- Tables over −50 … +120 °C (sweep from above) ----
+
+    PiecewiseLinearTable linear;
+    fillTable(linear);
+    benchMapper("PiecewiseLinearTable 8 pt", linear, 0.05f);
+
+    CubicHermiteMonotonicSplineTable hermite;
+    fillTable(hermite);
+    benchMapper("CubicHermiteMonotonicSpline 8 pt", hermite, 0.03f);
+
+    CubicSplineTable spline;
+    fillTable(spline);
+    benchMapper("CubicSplineTable 8 pt", spline, 0.02f);
+
+    static float lut[256];
+    LookupTableMapper grid(rtd, in[0], in[N - 1], lut, 256);
+    benchMapper("LookupTableMapper 256 pt", grid, 0.002f);
+
+    // ---- Filters: speed and scalar/block agreement ----
+
+    noisySignal();
+
+    benchFilter("EMAFilter", EMAFilter(0.1f));
+    benchFilter("AdaptiveAbsoluteEMAFilter", AdaptiveAbsoluteEMAFilter(0.05f, 1.0f));
+    benchFilter("AlphaBetaFilter", AlphaBetaFilter(0.5f, 0.1f));
+    benchFilter("KalmanFilter", KalmanFilter(0.25f, 0.001f));
+    benchFilter("KalmanFilter AUTO", KalmanFilter(0.25f, 0.001f, KalmanFilter::AUTO));
+    benchFilter("KalmanCVFilter", KalmanCVFilter(0.25f, 1e-5f));
+    benchFilter("Median3Filter", Median3Filter());
+    benchFilter("SMAFilter<16>", SMAFilter<16>());
+    benchFilter("RunningMedianFilter<15>", RunningMedianFilter<15>());
+    benchFilter("MovingMinMaxFilter<32>", MovingMinMaxFilter<32>());
+
+    BiquadCascadeFilter<2> butter;
+    butter.designLowPass(5.0f, 100.0f);
+    benchFilter("BiquadCascadeFilter<2> Butterworth", butter);
+
+    // fc/fs = 1e-2 and the design minimum 1e-3 run with double section state
+    BiquadCascadeFilter<2> slow;
+    slow.designLowPass(1.0f, 1000.0f);
+    benchFilter("BiquadCascadeFilter<2> fc/fs 1e-3", slow);
+
+    BiquadCascadeFilter<2> mid;
+    mid.designLowPass(1.0f, 100.0f);
+
+    benchDcSettling("Biquad<2> DC fc/fs 5e-2", butter, 2000, 100000, 0.0002f);
+    benchDcSettling("Biquad<2> DC fc/fs 1e-2", mid, 10000, 100000, 0.0002f);
+    benchDcSettling("Biquad<2> DC fc/fs 1e-3", slow, 20000, 100000, 0.0002f);
+
+    benchDecimator("CICDecimatorFilter R=16 M=3", "CICDecimatorFilter DC", CICDecimatorFilter(16, 3), 16);
+    benchDecimator("HalfBandDecimatorFilter<4>", "HalfBandDecimatorFilter<4> DC", HalfBandDecimatorFilter<4>(), 2);
+
+    Serial.print(failures == 0 ? "all passed" : "FAILURES: ");
+    if (failures > 0)
+    {
+        Serial.print(static_cast<unsigned>(failures));
+    }
+    Serial.println();
+}
+
+void loop() {}
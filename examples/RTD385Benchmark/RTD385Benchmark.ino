@@ -0,0 +1,91 @@
+/*
+ * RTD385Benchmark
+ *
+ * Compares the scalar RTD385::apply() against the branchless
+ * RTD385::applyBatch() over the full −200 … +661 °C range:
+ *   - time per sample for both paths
+ *   - max difference between both results in ulp
+ *
+ * Build with optimisation (-O2/-O3) and -fno-math-errno -fno-trapping-math
+ * (e.g. build_flags in platformio.ini) to let the batch
+ * loop vectorize on targets with SIMD floating point.
+ */
+
+#include <Arduino.h>
+#include <string.h>
+#include "RTD_385.h"
+
+static const size_t N = 1024;
+static const uint16_t ROUNDS = 50;
+
+static float R[N];
+static float T_scalar[N];
+static float T_batch[N];
+
+static RTD385 rtd(100.0f);
+
+static int32_t ulpDistance(float a, float b)
+{
+    int32_t ia, ib;
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+
+    // Map sign-magnitude to a monotonic integer line
+    if (ia < 0) { ia = INT32_MIN - ia; }
+    if (ib < 0) { ib = INT32_MIN - ib; }
+
+    int32_t d = ia - ib;
+    return (d < 0) ? -d : d;
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    delay(1000);
+
+    // 18.52 Ω … 333.1 Ω (Pt100, −200 … +661 °C)
+    for (size_t i = 0; i < N; i++)
+    {
+        R[i] = 18.52f + (333.1f - 18.52f) * i / (N - 1);
+    }
+
+    unsigned long t0 = micros();
+    for (uint16_t k = 0; k < ROUNDS; k++)
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            T_scalar[i] = rtd.apply(R[i]);
+        }
+    }
+    unsigned long tScalar = micros() - t0;
+
+    t0 = micros();
+    for (uint16_t k = 0; k < ROUNDS; k++)
+    {
+        rtd.applyBatch(R, T_batch, N);
+    }
+    unsigned long tBatch = micros() - t0;
+
+    int32_t maxUlp = 0;
+    for (size_t i = 0; i < N; i++)
+    {
+        int32_t d = ulpDistance(T_scalar[i], T_batch[i]);
+        if (d > maxUlp) { maxUlp = d; }
+    }
+
+    const float samples = static_cast<float>(N) * ROUNDS;
+
+    Serial.print("apply():      ");
+    Serial.print(1000.0f * tScalar / samples, 2);
+    Serial.println(" ns/sample");
+
+    Serial.print("applyBatch(): ");
+    Serial.print(1000.0f * tBatch / samples, 2);
+    Serial.println(" ns/sample");
+
+    Serial.print("max difference: ");
+    Serial.print(static_cast<long>(maxUlp));
+    Serial.println(" ulp");
+}
+
+void loop() {}
@@ -0,0 +1,69 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Minimal Arduino core for building the headers and example sketches on a
+// host (see Makefile): Serial on stdout, micros()/millis() on the monotonic
+// clock, PROGMEM as plain memory. Just enough for this library.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#define PROGMEM
+#define pgm_read_float(addr) (*reinterpret_cast<const float *>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t *>(addr))
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define DEC 10
+#define HEX 16
+
+inline unsigned long micros()
+{
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return static_cast<unsigned long>(duration_cast<microseconds>(steady_clock::now() - start).count());
+}
+
+inline unsigned long millis() { return micros() / 1000UL; }
+inline void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline int analogRead(uint8_t) { return 0; }
+
+class Print
+{
+public:
+    size_t print(const char *s) { return fputs(s, stdout) >= 0 ? strlen(s) : 0; }
+    size_t print(char c) { return fputc(c, stdout) != EOF ? 1 : 0; }
+    size_t print(long v, int base = DEC) { return printf(base == HEX ? "%lx" : "%ld", v); }
+    size_t print(unsigned long v, int base = DEC) { return printf(base == HEX ? "%lx" : "%lu", v); }
+    size_t print(int v, int base = DEC) { return print(static_cast<long>(v), base); }
+    size_t print(unsigned v, int base = DEC) { return print(static_cast<unsigned long>(v), base); }
+    size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+
+    size_t println() { return print("\n"); }
+
+    template <class T>
+    size_t println(T v) { return print(v) + println(); }
+
+    template <class T>
+    size_t println(T v, int format) { return print(v, format) + println(); }
+};
+
+class HostSerial : public Print
+{
+public:
+    void begin(unsigned long) {}
+    explicit operator bool() const { return true; }
+};
+
+static HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
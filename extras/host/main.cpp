@@ -0,0 +1,9 @@
+// Runs one example sketch on the host; the Makefile sets SKETCH_FILE
+#include <Arduino.h>
+#include SKETCH_FILE
+
+int main()
+{
+    setup();
+    return 0;
+}
@@ -5,7 +5,7 @@
 
 class BaseFilter : public BaseMeasurementProcessor
 {
-protected:
+public:
     enum FilterType : uint8_t
     {
         NONE = 0,           // No filter / passthrough
@@ -13,11 +13,33 @@ protected:
         ALPHA_BETA,          // Alpha-Beta filter (simple predictor)
         ADAPTIVE_ABSOLUTE_EMA,
         KALMAN,
-        MEDIAN3
+        MEDIAN3,
+        CIC_DECIMATOR,
+        HALF_BAND_DECIMATOR,
+        SIMPLE_MOVING_AVERAGE,
+        RUNNING_MEDIAN,
+        MOVING_MIN_MAX,
+        BIQUAD_CASCADE,
+        KALMAN_CV
     };
 
+protected:
     void setFilterType(FilterType type) { cfg.u[POS_SUB_TYPE] = type; }
 
+    // Extra data of a filter sized at compile time (window, tap count):
+    // one byte, so a snapshot taken with another size is rejected
+    static uint16_t saveWindow(uint8_t *dst, uint8_t size)
+    {
+        if (dst)
+        {
+            dst[0] = size;
+        }
+
+        return 1;
+    }
+
+    static bool checkWindow(const uint8_t *src, uint16_t len, uint8_t size) { return len == 1 && src[0] == size; }
+
 public:
     BaseFilter() { setProcessorType(ProcessorType::FILTER); }
 
@@ -5,7 +5,7 @@
 
 class BaseMapper : public BaseMeasurementProcessor
 {
-protected:
+public:
     enum MapperType : uint8_t
     {
         NONE = 0,
@@ -13,6 +13,7 @@ protected:
         FUNCTION
     };
 
+protected:
     void setMapperType(MapperType type) { cfg.u[POS_MAPPER_TYPE] = type; }
 
 public:
@@ -30,9 +30,20 @@ struct ProcessorConfig
 	float f[16]{};
 };
 
+// Fixed 80-byte layout on every target (no padding), stored as-is by PipelineSnapshot
+static_assert(sizeof(ProcessorConfig) == 80, "ProcessorConfig layout changed: bump PipelineSnapshot::VERSION");
+
+// One auxiliary value for a stage, e.g. the cold-junction temperature of a thermocouple
+struct SideInput
+{
+	uint8_t channel;
+	float value;
+};
+
 class BaseMeasurementProcessor
 {
-protected:
+public:
+	// Public so PipelineSnapshot / ProcessorFactory can decode the type tags
 	enum ProcessorType : uint8_t
 	{
 		NONE = 0,
@@ -40,19 +51,40 @@ protected:
 		FILTER
 	};
 
-	ProcessorConfig cfg;
-
 	static constexpr uint8_t POS_PROCESSOR_TYPE		= 0;
 	static constexpr uint8_t POS_MAPPER_TYPE 		= 1;
 	static constexpr uint8_t POS_SUB_TYPE			= 2;
 	static constexpr uint8_t POS_TABLE_SIZE			= 3;
 	static constexpr uint8_t POS_DEGREE				= 4;
 
+protected:
+	ProcessorConfig cfg;
+
+
+	// Cleared by decimating stages on inputs that produce no output
+	bool _outputReady;
 
 	void setProcessorType(ProcessorType type) { cfg.u[POS_PROCESSOR_TYPE] = type; }
 
+	// Same type tags: same concrete class for every non-template processor
+	bool sameType(const BaseMeasurementProcessor &other) const
+	{
+		return cfg.u[POS_PROCESSOR_TYPE] == other.cfg.u[POS_PROCESSOR_TYPE] && cfg.u[POS_MAPPER_TYPE] == other.cfg.u[POS_MAPPER_TYPE] &&
+			   cfg.u[POS_SUB_TYPE] == other.cfg.u[POS_SUB_TYPE];
+	}
+
+	// Called with cfg already replaced by the configuration to load: can the
+	// extra data saveExtra() wrote be restored into this instance (length,
+	// capacity of caller-owned storage, ranges)? Must not change anything.
+	virtual bool checkExtra(const uint8_t * /*src*/, uint16_t len) { return len == 0; }
+
+	// Called by loadConfig() after cfg was replaced and checkExtra() passed:
+	// restore the extra data and recompute anything derived from cfg.
+	// Returning false rolls cfg back.
+	virtual bool loadExtra(const uint8_t * /*src*/, uint16_t /*len*/) { return true; }
+
 public:
-	BaseMeasurementProcessor()
+	BaseMeasurementProcessor() : _outputReady(true)
 	{
 		for (int i = 0; i < 16; i++)
 		{
@@ -74,6 +106,26 @@ public:
 	virtual ~BaseMeasurementProcessor() {}
 	virtual float apply(float value) = 0;
 
+	// False if the last apply() emitted no new sample (decimating stages between
+	// outputs; apply() then returns the previous output). Pipelines skip all
+	// downstream stages and do not publish in that case.
+	inline bool outputReady() const { return _outputReady; }
+
+	// Block variant of apply(): processes n samples from in into out.
+	// in and out may point to the same buffer (in-place processing).
+	// Returns the number of samples written to out (n for all stages that
+	// emit one output per input, fewer for decimating stages).
+	// Override for a tight, devirtualized loop.
+	virtual size_t applyBlock(const float *in, float *out, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			out[i] = apply(in[i]);
+		}
+
+		return n;
+	}
+
 	void setFloat(uint8_t idx, float f)
 	{
 		idx = constrain(idx, 0, 15);
@@ -89,6 +141,91 @@ public:
 	void setUnits(uint8_t idx, uint32_t packedUnits){
 		cfg.unit[idx] = packedUnits;
 	}
+
+	const ProcessorConfig &getConfig() const { return cfg; }
+
+	// Data outside cfg that a snapshot needs (tables in caller storage, cached
+	// slopes/segments, coefficients that do not fit into cfg). Writes to dst
+	// and returns the byte count; dst == nullptr only returns the count.
+	virtual uint16_t saveExtra(uint8_t * /*dst*/) { return 0; }
+
+	// Pipeline fusion (BasicGenericSensor::optimize()). A stage that is exactly
+	// f(x) = m·x + b reports m and b; a stage that can absorb an affine map on
+	// its input (apply(x) becomes old apply(m·x + b)) or on its output
+	// (apply(x) becomes m·old apply(x) + b) rewrites its configuration and
+	// returns true. Results stay equal up to float rounding.
+	virtual bool getAffine(float & /*m*/, float & /*b*/) const { return false; }
+	virtual bool foldInputAffine(float /*m*/, float /*b*/) { return false; }
+	virtual bool foldOutputAffine(float /*m*/, float /*b*/) { return false; }
+
+	// Auxiliary input from outside the chain (another sensor's output), used
+	// from the next apply() on. Channel numbers are defined by the stage;
+	// returns false if it has no such channel.
+	virtual bool setSideInput(uint8_t /*channel*/, float /*value*/) { return false; }
+
+	// Variance of the current output, for stages that track one (Kalman
+	// filters); used for inverse-variance fusion by SensorVoter
+	virtual bool getErrorVariance(float & /*variance*/) const { return false; }
+
+	// Configuration swap (BasicGenericSensor::stagePipeline()): take over the
+	// runtime state (filter memory) of the stage being replaced, if it is of
+	// the same type. False, state untouched, for stateless stages, other
+	// types and templates (whose tags do not carry the template arguments).
+	virtual bool copyStateFrom(const BaseMeasurementProcessor & /*other*/) { return false; }
+
+	// Configuration is usable (sorted table, finite coefficients, ...);
+	// checked before a staged pipeline is accepted
+	virtual bool validate() const { return true; }
+
+	/**
+	 * Replace the configuration with a saved one of the same concrete type
+	 * (type tags must match). Runtime state (filter memory) is kept; derived
+	 * caches are restored from extra or recomputed. Not synchronised with
+	 * push(): restore before pushing starts or from the producer task.
+	 */
+	bool loadConfig(const ProcessorConfig &config, const uint8_t *extra = nullptr, uint16_t extraLen = 0)
+	{
+		for (uint8_t i = POS_PROCESSOR_TYPE; i <= POS_SUB_TYPE; i++)
+		{
+			if (config.u[i] != cfg.u[i])
+			{
+				return false;
+			}
+		}
+
+		const ProcessorConfig previous = cfg;
+		cfg = config;
+
+		if (!checkExtra(extra, extraLen) || !loadExtra(extra, extraLen))
+		{
+			cfg = previous;
+			return false;
+		}
+
+		return true;
+	}
+
+	// Would loadConfig() accept config and extra? Changes nothing (cfg is
+	// swapped for the check and put back), so a multi-slot restore can test
+	// every slot before loading the first one.
+	bool canLoadConfig(const ProcessorConfig &config, const uint8_t *extra = nullptr, uint16_t extraLen = 0)
+	{
+		for (uint8_t i = POS_PROCESSOR_TYPE; i <= POS_SUB_TYPE; i++)
+		{
+			if (config.u[i] != cfg.u[i])
+			{
+				return false;
+			}
+		}
+
+		const ProcessorConfig previous = cfg;
+		cfg = config;
+
+		const bool ok = checkExtra(extra, extraLen);
+
+		cfg = previous;
+		return ok;
+	}
 };
 
 #endif // IMEASUREMENTPROCESSOR_H
\ No newline at end of file
@@ -0,0 +1,153 @@
+#ifndef CHANGE_DETECTOR_H
+#define CHANGE_DETECTOR_H
+
+#include <Arduino.h>
+
+#if !defined(__AVR__)
+#include <atomic>
+#endif
+
+// Called from the producer (inside push()) with the value being reported
+typedef void (*ChangeCallback)(float value, void *context);
+
+/**
+ * Report-by-exception filter for a sensor output: decides which values are
+ * worth publishing downstream (MQTT, CAN, radio).
+ *
+ * A value is reported when any condition holds:
+ *     deadband    |value - last reported| > deadband (0: any change)
+ *     rate        |value - previous update| / dt > rate, in units per
+ *                 second, so a fast move inside the deadband still reports
+ *                 (0: off)
+ *     heartbeat   heartbeatMs elapsed since the last report (0: off)
+ * and always for the first update. A report stores the value, raises the
+ * dirty flag and fires the callback, if any.
+ *
+ * The dirty flag is atomic: the producer sets it inside push(), a publisher
+ * task tests and clears it with consumeChanged() (SensorSpan::pollChanged()
+ * does that for up to 64 sensors at once). Thresholds are set before the
+ * detector is attached.
+ *
+ * Example usage:
+ *     ChangeDetector change(0.05f, 0.0f, 60000);   // 0.05 °C, no rate limit, 1 min heartbeat
+ *     sensor.setChangeDetector(&change);
+ *     ...
+ *     if (change.consumeChanged()) { mqtt.publish(topic, change.getReportedValue()); }
+ */
+class ChangeDetector
+{
+private:
+    float _deadband;
+    float _rate;
+    uint32_t _heartbeatMs;
+
+    ChangeCallback _callback;
+    void *_context;
+
+    float _reported;
+    uint32_t _reportedMs;
+    float _previous;
+    uint32_t _previousMs;
+    bool _primed;
+
+#if defined(__AVR__)
+    volatile bool _dirty;
+
+    inline void setDirty() { __asm__ __volatile__("" ::: "memory"); _dirty = true; }
+#else
+    std::atomic<bool> _dirty;
+
+    inline void setDirty() { _dirty.store(true, std::memory_order_release); }
+#endif
+
+    uint32_t _reports;
+
+public:
+    explicit ChangeDetector(float deadband = 0.0f, float ratePerSecond = 0.0f, uint32_t heartbeatMs = 0)
+        : _deadband(deadband), _rate(ratePerSecond), _heartbeatMs(heartbeatMs), _callback(nullptr), _context(nullptr),
+          _reported(0.0f), _reportedMs(0), _previous(0.0f), _previousMs(0), _primed(false), _dirty(false), _reports(0)
+    {
+    }
+
+    ChangeDetector(const ChangeDetector &) = delete;
+    ChangeDetector &operator=(const ChangeDetector &) = delete;
+
+    void setDeadband(float deadband) { _deadband = deadband; }
+    void setRate(float ratePerSecond) { _rate = ratePerSecond; }
+    void setHeartbeat(uint32_t heartbeatMs) { _heartbeatMs = heartbeatMs; }
+
+    void setCallback(ChangeCallback callback, void *context = nullptr)
+    {
+        _callback = callback;
+        _context = context;
+    }
+
+    // Producer: feed the next output; true if it was reported
+    bool update(float value, uint32_t nowMs)
+    {
+        bool report = !_primed;
+
+        if (!report)
+        {
+            report = (_deadband > 0.0f) ? fabsf(value - _reported) > _deadband : value != _reported;
+        }
+
+        if (!report && _rate > 0.0f && nowMs != _previousMs)
+        {
+            report = fabsf(value - _previous) > _rate * (nowMs - _previousMs) * 0.001f;
+        }
+
+        if (!report && _heartbeatMs > 0)
+        {
+            report = (nowMs - _reportedMs) >= _heartbeatMs;
+        }
+
+        _previous = value;
+        _previousMs = nowMs;
+        _primed = true;
+
+        if (report)
+        {
+            _reported = value;
+            _reportedMs = nowMs;
+            _reports++;
+            setDirty();
+
+            if (_callback)
+            {
+                _callback(value, _context);
+            }
+        }
+
+        return report;
+    }
+
+    // Reader: true once per report burst; clears the flag
+#if defined(__AVR__)
+    bool consumeChanged()
+    {
+        uint8_t sreg = SREG;
+        cli();
+        const bool dirty = _dirty;
+        _dirty = false;
+        SREG = sreg;
+        return dirty;
+    }
+
+    bool isChanged() const { return _dirty; }
+#else
+    bool consumeChanged() { return _dirty.exchange(false, std::memory_order_acq_rel); }
+
+    bool isChanged() const { return _dirty.load(std::memory_order_acquire); }
+#endif
+
+    // Last reported value (what downstream should hold)
+    float getReportedValue() const { return _reported; }
+    uint32_t getReportedMillis() const { return _reportedMs; }
+    uint32_t getReportCount() const { return _reports; }
+
+    // Forget the reported value: the next update reports again
+    void reset() { _primed = false; }
+};
+
+#endif // CHANGE_DETECTOR_H
@@ -0,0 +1,100 @@
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#include <Arduino.h>
+
+#if defined(ESP32)
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include <esp_cpu.h>
+#endif
+#endif
+
+// Cortex-M cores with a DWT cycle counter (M3/M4/M7/M33)
+#if !defined(ESP32) && (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__))
+#define CYCLE_COUNTER_DWT 1
+#endif
+
+/**
+ * Free-running CPU cycle counter for micro-benchmarks.
+ *
+ *   - ESP32:              esp_cpu_get_cycle_count() (IDF 5), ESP.getCycleCount() before
+ *   - Cortex-M3/M4/M7/M33 (STM32 etc.): DWT->CYCCNT, enabled by begin()
+ *   - anything else:      micros(), i.e. one "cycle" per µs
+ *
+ * The counter is 32 bit and wraps (≈ 17.9 s at 240 MHz); elapsed() handles a
+ * single wrap, so keep measured sections well below that.
+ *
+ * Example usage:
+ *     CycleCounter::begin();
+ *     uint32_t t0 = CycleCounter::now();
+ *     rtd.applyBlock(R, T, 256);
+ *     float ns = CycleCounter::toNs(CycleCounter::elapsed(t0)) / 256;
+ */
+class CycleCounter
+{
+public:
+#if defined(ESP32)
+    static constexpr bool HAS_CYCLES = true;
+#elif defined(CYCLE_COUNTER_DWT)
+    static constexpr bool HAS_CYCLES = true;
+#else
+    static constexpr bool HAS_CYCLES = false;
+#endif
+
+    // Enable the counter where it needs enabling (DWT on Cortex-M)
+    static void begin()
+    {
+#if defined(CYCLE_COUNTER_DWT)
+        DEMCR() |= DEMCR_TRCENA;
+        DWT_CYCCNT() = 0;
+        DWT_CTRL() |= DWT_CTRL_CYCCNTENA;
+#endif
+    }
+
+    static inline uint32_t now()
+    {
+#if defined(ESP32)
+#if ESP_IDF_VERSION_MAJOR >= 5
+        return static_cast<uint32_t>(esp_cpu_get_cycle_count());
+#else
+        return ESP.getCycleCount();
+#endif
+#elif defined(CYCLE_COUNTER_DWT)
+        return DWT_CYCCNT();
+#else
+        return static_cast<uint32_t>(micros());
+#endif
+    }
+
+    static inline uint32_t elapsed(uint32_t start) { return now() - start; }
+
+    // Counter ticks per second
+    static uint32_t frequency()
+    {
+#if defined(ESP32)
+        return getCpuFrequencyMhz() * 1000000UL;
+#elif defined(CYCLE_COUNTER_DWT) && defined(F_CPU)
+        return F_CPU;
+#elif defined(CYCLE_COUNTER_DWT)
+        return SystemCoreClock;
+#else
+        return 1000000UL;
+#endif
+    }
+
+    static float toNs(uint32_t ticks) { return ticks * (1.0e9f / frequency()); }
+
+private:
+#if defined(CYCLE_COUNTER_DWT)
+    // ARMv7-M / ARMv8-M debug registers, addressed directly to avoid a CMSIS device header
+    static constexpr uint32_t DEMCR_TRCENA      = 1UL << 24;
+    static constexpr uint32_t DWT_CTRL_CYCCNTENA = 1UL << 0;
+
+    static inline volatile uint32_t &DEMCR()      { return *reinterpret_cast<volatile uint32_t *>(0xE000EDFCUL); }
+    static inline volatile uint32_t &DWT_CTRL()   { return *reinterpret_cast<volatile uint32_t *>(0xE0001000UL); }
+    static inline volatile uint32_t &DWT_CYCCNT() { return *reinterpret_cast<volatile uint32_t *>(0xE0001004UL); }
+#endif
+};
+
+#endif // CYCLE_COUNTER_H
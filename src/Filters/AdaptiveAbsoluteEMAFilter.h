@@ -48,6 +48,20 @@ public:
 
     float getAlpha() const { return alpha; }
 
+    bool copyStateFrom(const BaseMeasurementProcessor &other) override
+    {
+        if (!sameType(other))
+        {
+            return false;
+        }
+
+        const AdaptiveAbsoluteEMAFilter &o = static_cast<const AdaptiveAbsoluteEMAFilter &>(other);
+        alpha = o.alpha;
+        prev_filtered = o.prev_filtered;
+        initialized = o.initialized;
+        return true;
+    }
+
 private:
     float mapf(float x, float in_min, float in_max, float out_min, float out_max)
     {
@@ -39,6 +39,20 @@ public:
 
         return _level + _trend;
     }
+
+    bool copyStateFrom(const BaseMeasurementProcessor &other) override
+    {
+        if (!sameType(other))
+        {
+            return false;
+        }
+
+        const AlphaBetaFilter &o = static_cast<const AlphaBetaFilter &>(other);
+        _level = o._level;
+        _trend = o._trend;
+        _initialized = o._initialized;
+        return true;
+    }
 };
 
 #endif // ALPHABETAFILTER_H
\ No newline at end of file
@@ -0,0 +1,411 @@
+#ifndef BIQUAD_CASCADE_FILTER_H
+#define BIQUAD_CASCADE_FILTER_H
+
+#include "BaseFilter.h"
+#include <Arduino.h>
+
+#if defined(GENERIC_SENSOR_USE_CMSIS_DSP)
+#include <arm_math.h>
+#endif
+
+/**
+ * Cascade of S second-order IIR sections in transposed direct form II.
+ *
+ * Per section (5 multiplies, 4 adds):
+ *     y  = b0·x + d1
+ *     d1 = b1·x + a1·y + d2
+ *     d2 = b2·x + a2·y
+ *
+ * Coefficients and state use the CMSIS-DSP layout: per section
+ * {b0, b1, b2, a1, a2} with the feedback terms already negated relative to
+ * H(z) = (b0 + b1·z⁻¹ + b2·z⁻²) / (1 + A1·z⁻¹ + A2·z⁻²), i.e. a1 = -A1,
+ * a2 = -A2; state {d1, d2} per section. setSection() takes the textbook
+ * sign (A1, A2) and converts.
+ *
+ * designLowPass()/designHighPass() fill all sections with an order-2S
+ * Butterworth filter (bilinear transform, RBJ sections with
+ * Q_k = 1 / (2·cos(π·(2k + 1) / (4S)))). The first sample primes every
+ * section to its steady state, so a low-pass starts at the input value.
+ *
+ * Low cut-offs: the feedback of a section cancels to 1 - a1 - a2 ≈ ω₀²,
+ * so float state rounding is amplified by about (fs / fc)² and a low-pass
+ * settles off the input (or drifts) below fc/fs ≈ 1e-2. Sections that
+ * narrow (1 - a1 - a2 < WIDE_STATE_DENOMINATOR) therefore keep their state
+ * in double; on AVR, where double is float, they stay float. The float
+ * coefficients themselves bend the response below MIN_CUTOFF_RATIO, so
+ * the design clamps fc to at least MIN_CUTOFF_RATIO·fs (decimate first,
+ * e.g. with a CICDecimatorFilter, for slower filters) and validate()
+ * rejects sections without a finite, stable DC response.
+ *
+ * applyBlock() runs section by section over the whole block with the state
+ * in registers. With GENERIC_SENSOR_USE_CMSIS_DSP defined it calls
+ * arm_biquad_cascade_df2T_f32() instead (float state only), which shares
+ * the coefficient and state arrays, so apply() and applyBlock() can be
+ * mixed freely.
+ *
+ * Example usage (4th order low-pass, 5 Hz at 100 Hz sample rate):
+ *     BiquadCascadeFilter<2> lp;
+ *     lp.designLowPass(5.0f, 100.0f);
+ *     sensor.setFilter(0, &lp);
+ */
+template <uint8_t S>
+class BiquadCascadeFilter : public BaseFilter
+{
+    static_assert(S >= 1, "BiquadCascadeFilter needs at least one section");
+
+public:
+    static constexpr uint8_t COEFFS_PER_SECTION = 5;
+
+    // Lowest fc/fs designLowPass()/designHighPass() accept (fc is clamped up)
+    static constexpr float MIN_CUTOFF_RATIO = 1e-3f;
+
+    // 1 - a1 - a2 below which a section keeps double state (fc/fs ≈ 1e-2)
+    static constexpr float WIDE_STATE_DENOMINATOR = 4e-3f;
+
+    // 1 - a1 - a2 below which validate() fails (fc/fs ≈ 5e-4)
+    static constexpr float MIN_DENOMINATOR = 1e-5f;
+
+private:
+    // Design parameters in cfg storage (the coefficients do not fit for S > 3)
+    inline float &cutoff()     { return cfg.f[0]; }
+    inline float &sampleRate() { return cfg.f[1]; }
+
+    float _coeffs[COEFFS_PER_SECTION * S]; // {b0, b1, b2, a1, a2} per section, CMSIS sign
+
+    // {d1, d2} per section: float, or double for narrow designs (_wide)
+    union
+    {
+        float f[2 * S];
+        double d[2 * S];
+    } _state;
+
+    bool _wide;
+    bool _initialized;
+
+#if defined(GENERIC_SENSOR_USE_CMSIS_DSP)
+    arm_biquad_cascade_df2T_instance_f32 _cmsis;
+#endif
+
+    // Steady state for a constant input x, section by section. Once per start,
+    // in double: 1 - a1 - a2 cancels badly for cut-offs far below fs.
+    template <typename T>
+    void prime(T *state, float x)
+    {
+        double xd = x;
+
+        for (uint8_t k = 0; k < S; k++)
+        {
+            const float *c = &_coeffs[COEFFS_PER_SECTION * k];
+            double den = 1.0 - c[3] - c[4];
+            double y = (den != 0.0) ? xd * ((double)c[0] + c[1] + c[2]) / den : 0.0;
+
+            state[2 * k + 1] = static_cast<T>(c[2] * xd + c[4] * y);
+            state[2 * k] = static_cast<T>(y - c[0] * xd);
+
+            // Between sections the signal is float, as in applyBlock()
+            xd = static_cast<float>(y);
+        }
+
+        _initialized = true;
+    }
+
+    void prime(float x)
+    {
+        if (_wide)
+        {
+            prime(_state.d, x);
+        }
+        else
+        {
+            prime(_state.f, x);
+        }
+    }
+
+    // One sample through every section
+    template <typename T>
+    float applySections(T *state, float value)
+    {
+        for (uint8_t k = 0; k < S; k++)
+        {
+            const float *c = &_coeffs[COEFFS_PER_SECTION * k];
+            T *d = &state[2 * k];
+            const T x = value;
+
+            const T y = c[0] * x + d[0];
+            d[0] = c[1] * x + c[3] * y + d[1];
+            d[1] = c[2] * x + c[4] * y;
+
+            value = static_cast<float>(y);
+        }
+
+        return value;
+    }
+
+    // Section-major: one section over the whole block, then the next (in place)
+    template <typename T>
+    void blockSections(T *state, const float *in, float *out, size_t n)
+    {
+        const float *src = in;
+
+        for (uint8_t k = 0; k < S; k++)
+        {
+            const float *c = &_coeffs[COEFFS_PER_SECTION * k];
+            const float b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+            T d1 = state[2 * k];
+            T d2 = state[2 * k + 1];
+
+            for (size_t i = 0; i < n; i++)
+            {
+                const T x = src[i];
+                const T y = b0 * x + d1;
+                d1 = b1 * x + a1 * y + d2;
+                d2 = b2 * x + a2 * y;
+                out[i] = static_cast<float>(y);
+            }
+
+            state[2 * k] = d1;
+            state[2 * k + 1] = d2;
+            src = out;
+        }
+    }
+
+    void storeSection(uint8_t k, float b0, float b1, float b2, float A1, float A2)
+    {
+        float *c = &_coeffs[COEFFS_PER_SECTION * k];
+
+        c[0] = b0;
+        c[1] = b1;
+        c[2] = b2;
+        c[3] = -A1;
+        c[4] = -A2;
+    }
+
+    // Double state as soon as one section is narrow; a width change restarts the filter
+    void updateStateWidth()
+    {
+        bool wide = false;
+
+        for (uint8_t k = 0; k < S; k++)
+        {
+            const float *c = &_coeffs[COEFFS_PER_SECTION * k];
+            wide = wide || (1.0 - c[3] - c[4] < WIDE_STATE_DENOMINATOR);
+        }
+
+        wide = wide && (sizeof(double) > sizeof(float));
+
+        if (wide != _wide)
+        {
+            _wide = wide;
+            reset();
+        }
+    }
+
+    // In double: 1 - cos(w0) loses most of its float digits at low cut-offs
+    void setRbjSection(uint8_t k, float fc, float fs, float q, bool highPass)
+    {
+        double w0 = 2.0 * PI * fc / fs;
+        double cw = cos(w0);
+        double alpha = sin(w0) / (2.0 * q);
+        double a0 = 1.0 + alpha;
+
+        double b1 = highPass ? -(1.0 + cw) : (1.0 - cw);
+        double b0 = highPass ? (1.0 + cw) * 0.5 : (1.0 - cw) * 0.5;
+
+        setSection(k, static_cast<float>(b0 / a0), static_cast<float>(b1 / a0), static_cast<float>(b0 / a0),
+                   static_cast<float>(-2.0 * cw / a0), static_cast<float>((1.0 - alpha) / a0));
+    }
+
+    // Scale the numerator so the float coefficients have unity DC gain
+    // (rounding of low cut-off designs otherwise leaves ~1e-5 gain error)
+    void normalizeDcGain(uint8_t k)
+    {
+        float *c = &_coeffs[COEFFS_PER_SECTION * k];
+        double gain = ((double)c[0] + c[1] + c[2]) / (1.0 - c[3] - c[4]);
+
+        if (gain != 0.0)
+        {
+            for (uint8_t i = 0; i < 3; i++)
+            {
+                c[i] = static_cast<float>(c[i] / gain);
+            }
+        }
+    }
+
+    void designButterworth(float fc, float fs, bool highPass)
+    {
+        fc = constrain(fc, MIN_CUTOFF_RATIO * fs, 0.49f * fs);
+        cutoff() = fc;
+        sampleRate() = fs;
+
+        for (uint8_t k = 0; k < S; k++)
+        {
+            float q = 1.0f / (2.0f * cosf(PI * (2 * k + 1) / (4.0f * S)));
+            setRbjSection(k, fc, fs, q, highPass);
+
+            if (!highPass)
+            {
+                normalizeDcGain(k);
+            }
+        }
+
+        reset();
+    }
+
+protected:
+    // Section coefficients live outside cfg; loading restarts the filter
+    bool checkExtra(const uint8_t * /*src*/, uint16_t len) override { return len == sizeof(_coeffs); }
+
+    bool loadExtra(const uint8_t *src, uint16_t /*len*/) override
+    {
+        memcpy(_coeffs, src, sizeof(_coeffs));
+        updateStateWidth();
+        return true;
+    }
+
+public:
+    BiquadCascadeFilter() : _wide(false), _initialized(false)
+    {
+        for (uint8_t k = 0; k < S; k++)
+        {
+            storeSection(k, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f); // pass through
+        }
+
+        memset(&_state, 0, sizeof(_state));
+
+#if defined(GENERIC_SENSOR_USE_CMSIS_DSP)
+        arm_biquad_cascade_df2T_init_f32(&_cmsis, S, _coeffs, _state.f);
+#endif
+
+        setFilterType(FilterType::BIQUAD_CASCADE);
+    }
+
+    // The CMSIS instance points into this object: copies need their own
+    BiquadCascadeFilter(const BiquadCascadeFilter &other) : BaseFilter(other), _wide(other._wide), _initialized(other._initialized)
+    {
+        memcpy(_coeffs, other._coeffs, sizeof(_coeffs));
+        memcpy(&_state, &other._state, sizeof(_state));
+
+#if defined(GENERIC_SENSOR_USE_CMSIS_DSP)
+        arm_biquad_cascade_df2T_init_f32(&_cmsis, S, _coeffs, _state.f);
+#endif
+    }
+
+    BiquadCascadeFilter &operator=(const BiquadCascadeFilter &other)
+    {
+        BaseFilter::operator=(other);
+        _wide = other._wide;
+        _initialized = other._initialized;
+
+        memcpy(_coeffs, other._coeffs, sizeof(_coeffs));
+        memcpy(&_state, &other._state, sizeof(_state));
+
+        return *this;
+    }
+
+    ~BiquadCascadeFilter() {}
+
+    float apply(float value) override
+    {
+        if (!_initialized)
+        {
+            prime(value);
+        }
+
+        return _wide ? applySections(_state.d, value) : applySections(_state.f, value);
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        if (!_initialized)
+        {
+            prime(in[0]);
+        }
+
+        if (_wide)
+        {
+            blockSections(_state.d, in, out, n);
+            return n;
+        }
+
+#if defined(GENERIC_SENSOR_USE_CMSIS_DSP)
+        arm_biquad_cascade_df2T_f32(&_cmsis, in, out, n);
+#else
+        blockSections(_state.f, in, out, n);
+#endif
+
+        return n;
+    }
+
+    // Section k of H(z) = (b0 + b1·z⁻¹ + b2·z⁻²) / (1 + A1·z⁻¹ + A2·z⁻²)
+    void setSection(uint8_t k, float b0, float b1, float b2, float A1, float A2)
+    {
+        if (k < S)
+        {
+            storeSection(k, b0, b1, b2, A1, A2);
+            updateStateWidth();
+        }
+    }
+
+    // Single RBJ low-/high-pass section with quality factor q (0.7071 = Butterworth)
+    void setLowPassSection(uint8_t k, float fc, float fs, float q = 0.70710678f) { setRbjSection(k, fc, fs, q, false); }
+    void setHighPassSection(uint8_t k, float fc, float fs, float q = 0.70710678f) { setRbjSection(k, fc, fs, q, true); }
+
+    // Order-2S Butterworth over all sections; restarts the filter
+    void designLowPass(float fc, float fs) { designButterworth(fc, fs, false); }
+    void designHighPass(float fc, float fs) { designButterworth(fc, fs, true); }
+
+    // CMSIS-DSP coefficient / state arrays (5·S and 2·S floats); the state
+    // array is only in that layout while usesDoubleState() is false
+    const float *coefficients() const { return _coeffs; }
+    float *state() { return _state.f; }
+    bool usesDoubleState() const { return _wide; }
+
+    void reset() { _initialized = false; }
+
+    // Finite coefficients and every section stable with a usable DC response:
+    // 1 - a1 - a2 ≥ MIN_DENOMINATOR, poles inside the unit circle
+    bool validate() const override
+    {
+        for (uint8_t k = 0; k < S; k++)
+        {
+            const float *c = &_coeffs[COEFFS_PER_SECTION * k];
+
+            for (uint8_t i = 0; i < COEFFS_PER_SECTION; i++)
+            {
+                if (!isfinite(c[i]))
+                {
+                    return false;
+                }
+            }
+
+            const double den = 1.0 - c[3] - c[4];
+            const double gain = ((double)c[0] + c[1] + c[2]) / den;
+
+            if (!(den >= MIN_DENOMINATOR) || !isfinite(gain) || !(fabsf(c[4]) < 1.0f) || !(1.0 + c[3] - c[4] > 0.0))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    uint16_t saveExtra(uint8_t *dst) override
+    {
+        if (dst)
+        {
+            memcpy(dst, _coeffs, sizeof(_coeffs));
+        }
+
+        return sizeof(_coeffs);
+    }
+
+    static constexpr uint8_t sections() { return S; }
+};
+
+#endif // BIQUAD_CASCADE_FILTER_H
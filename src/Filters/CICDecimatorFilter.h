@@ -0,0 +1,210 @@
+#ifndef CIC_DECIMATOR_FILTER_H
+#define CIC_DECIMATOR_FILTER_H
+
+#include "BaseFilter.h"
+#include <Arduino.h>
+
+/**
+ * Cascaded integrator-comb (Hogenauer) decimator: order M integrators at
+ * input rate, one output every R inputs through M combs (differential delay 1).
+ * Equivalent to M cascaded moving averages of length R, normalised to unity
+ * DC gain. Costs M adds per input, M subtracts and one divide per output.
+ *
+ * Integrators run on 64-bit wrap-around integers, so they may overflow
+ * freely as long as the output fits: requires
+ *     log2(input range · inputScale) + M · log2(R) < 63
+ * e.g. 16-bit ADC counts, M = 3, R = 2000 → 16 + 33 = 49 bits. Float inputs
+ * are rounded to integers after multiplying by inputScale (1 for raw counts,
+ * e.g. 65536 for a signal in volts).
+ *
+ * apply() returns the last output and clears outputReady() on the R - 1
+ * inputs in between outputs, so GenericSensor / StaticSensor stop the chain
+ * there: stages behind the decimator run at output rate only.
+ * The first sample primes the filter to steady state (M·R integrator steps
+ * once) and is emitted unchanged.
+ *
+ * Example usage (20 kHz ADC → 10 Hz, mapper behind the decimator):
+ *     CICDecimatorFilter cic(2000, 3);
+ *     RTD385 rtd(100.0f);
+ *     sensor.setMapper(0, &cic);
+ *     sensor.setMapper(1, &rtd);
+ */
+class CICDecimatorFilter : public BaseFilter
+{
+public:
+    static constexpr uint8_t MAX_ORDER = 5;
+
+private:
+    // Accessors into cfg storage
+    inline float &ratioF()     { return cfg.f[0]; }
+    inline float &inputScale() { return cfg.f[1]; }
+    inline float &outputDiv()  { return cfg.f[2]; }  // inputScale · R^M
+    inline uint8_t &order()    { return cfg.u[POS_DEGREE]; }
+
+    uint32_t _ratio;
+    uint32_t _phase;
+    uint64_t _integ[MAX_ORDER];
+    uint64_t _comb[MAX_ORDER];
+    float _out;
+    bool _initialized;
+
+    void updateGain()
+    {
+        float div = inputScale();
+
+        for (uint8_t k = 0; k < order(); k++)
+        {
+            div *= _ratio;
+        }
+
+        outputDiv() = div;
+    }
+
+    // One input sample; true if it completed an output period
+    inline bool step(float value)
+    {
+        const uint8_t m = order();
+        uint64_t x = static_cast<uint64_t>(llrintf(value * inputScale()));
+
+        _integ[0] += x;
+        for (uint8_t k = 1; k < m; k++)
+        {
+            _integ[k] += _integ[k - 1];
+        }
+
+        if (++_phase < _ratio)
+        {
+            return false;
+        }
+
+        _phase = 0;
+
+        uint64_t y = _integ[m - 1];
+        for (uint8_t k = 0; k < m; k++)
+        {
+            uint64_t delayed = _comb[k];
+            _comb[k] = y;
+            y -= delayed;
+        }
+
+        // Divide at output rate: exact for constant integer inputs
+        _out = static_cast<float>(static_cast<int64_t>(y)) / outputDiv();
+        return true;
+    }
+
+    // Run as if value had been applied forever, ending one sample before an output
+    void prime(float value)
+    {
+        for (uint8_t k = 0; k < MAX_ORDER; k++)
+        {
+            _integ[k] = 0;
+            _comb[k] = 0;
+        }
+
+        _phase = 0;
+
+        const uint32_t warmup = order() * _ratio - 1;
+        for (uint32_t i = 0; i < warmup; i++)
+        {
+            step(value);
+        }
+
+        _initialized = true;
+    }
+
+protected:
+    bool checkExtra(const uint8_t * /*src*/, uint16_t len) override
+    {
+        return len == 0 && order() >= 1 && order() <= MAX_ORDER && ratioF() >= 1.0f;
+    }
+
+    // R is cached as an integer; a new configuration restarts the filter
+    bool loadExtra(const uint8_t * /*src*/, uint16_t /*len*/) override
+    {
+        _ratio = static_cast<uint32_t>(ratioF());
+        reset();
+        return true;
+    }
+
+public:
+    CICDecimatorFilter(uint32_t ratio = 16, uint8_t m = 3)
+        : _ratio(1), _phase(0), _integ{}, _comb{}, _out(0.0f), _initialized(false)
+    {
+        inputScale() = 1.0f;
+        order() = constrain(m, 1, MAX_ORDER);
+        setRatio(ratio);
+        setFilterType(FilterType::CIC_DECIMATOR);
+    }
+
+    ~CICDecimatorFilter() {}
+
+    float apply(float value) override
+    {
+        if (!_initialized)
+        {
+            prime(value);
+        }
+
+        _outputReady = step(value);
+        return _out;
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        size_t emitted = 0;
+        bool ready = false;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            if (!_initialized)
+            {
+                prime(in[i]);
+            }
+
+            ready = step(in[i]);
+
+            if (ready)
+            {
+                out[emitted++] = _out;
+            }
+        }
+
+        if (n > 0)
+        {
+            _outputReady = ready;
+        }
+
+        return emitted;
+    }
+
+    // Decimation ratio R >= 1; restarts the filter
+    void setRatio(uint32_t ratio)
+    {
+        _ratio = (ratio < 1) ? 1 : ratio;
+        ratioF() = static_cast<float>(_ratio);
+        updateGain();
+        reset();
+    }
+
+    // Number of integrator/comb pairs, 1 … MAX_ORDER; restarts the filter
+    void setOrder(uint8_t m)
+    {
+        order() = constrain(m, 1, MAX_ORDER);
+        updateGain();
+        reset();
+    }
+
+    // Scale applied before rounding inputs to integers; restarts the filter
+    void setInputScale(float scale)
+    {
+        inputScale() = (scale > 0.0f) ? scale : 1.0f;
+        updateGain();
+        reset();
+    }
+
+    void reset() { _initialized = false; }
+
+    uint32_t getRatio() const { return _ratio; }
+};
+
+#endif // CIC_DECIMATOR_FILTER_H
@@ -42,6 +42,51 @@ public:
         return _ema;
     }
 
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        size_t i = 0;
+
+        if (!_initialized)
+        {
+            prime(in[0]);
+            out[0] = _ema;
+            i = 1;
+        }
+
+        // Keep state and coefficients in registers for the whole block
+        const float a = alpha();
+        const float k = 1.0f - a;
+        float ema = _ema;
+
+        for (; i < n; i++)
+        {
+            ema = ema * k + in[i] * a;
+            out[i] = ema;
+        }
+
+        _ema = ema;
+
+        return n;
+    }
+
+    bool copyStateFrom(const BaseMeasurementProcessor &other) override
+    {
+        if (!sameType(other))
+        {
+            return false;
+        }
+
+        const EMAFilter &o = static_cast<const EMAFilter &>(other);
+        _initialized = o._initialized;
+        _ema = o._ema;
+        return true;
+    }
+
     void setAlpha(float a)
     {
         a = constrain(a, std::nextafter(0.0f,1.0f), 1.0f);
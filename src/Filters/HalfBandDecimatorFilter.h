@@ -0,0 +1,192 @@
+#ifndef HALF_BAND_DECIMATOR_FILTER_H
+#define HALF_BAND_DECIMATOR_FILTER_H
+
+#include "BaseFilter.h"
+#include <Arduino.h>
+
+/**
+ * Decimate-by-2 half-band FIR in polyphase form.
+ *
+ * Length L = 4·TAPS - 1. Every other coefficient of a half-band filter is
+ * zero except the centre tap (0.5), so the filter splits into a pure delay
+ * and TAPS symmetric pairs. Only every second input is computed:
+ * TAPS multiplies per output, i.e. TAPS / 2 per input.
+ *
+ * The default coefficients are a Blackman-windowed sinc normalised to
+ * unity DC gain; setCoefficient() loads a custom design (k-th pair, offset
+ * ±(2k + 1) from the centre). Group delay: 2·TAPS - 1 input samples.
+ *
+ * Like CICDecimatorFilter, apply() clears outputReady() on inputs without
+ * output and returns the previous output. Stack stages for 4×, 8×, … or use
+ * one behind a CIC to flatten its passband droop.
+ *
+ * Example usage:
+ *     CICDecimatorFilter cic(500, 3);
+ *     HalfBandDecimatorFilter<> hb;       // 20 kHz → 40 Hz → 20 Hz
+ *     sensor.setMapper(0, &cic);
+ *     sensor.setMapper(1, &hb);
+ *     sensor.setMapper(2, &rtd);
+ */
+template <uint8_t TAPS = 4>
+class HalfBandDecimatorFilter : public BaseFilter
+{
+    static_assert(TAPS >= 1 && TAPS <= 16, "HalfBandDecimatorFilter: TAPS must be 1 … 16 (coefficients live in cfg.f)");
+
+public:
+    static constexpr uint8_t LENGTH = 4 * TAPS - 1;
+    static constexpr uint8_t CENTER = 2 * TAPS - 1;
+
+private:
+    // Accessors into cfg storage
+    inline float &h(uint8_t k) { return cfg.f[k]; }
+
+    // Every sample stored twice so the window [_pos, _pos + LENGTH) never wraps
+    float _buf[2 * LENGTH];
+    uint8_t _pos;
+    bool _odd;
+    float _out;
+    bool _initialized;
+
+    inline void store(float value)
+    {
+        _buf[_pos] = value;
+        _buf[_pos + LENGTH] = value;
+        _pos = (_pos + 1 < LENGTH) ? _pos + 1 : 0;
+    }
+
+    // One input sample; true on every second one
+    inline bool step(float value)
+    {
+        store(value);
+
+        _odd = !_odd;
+        if (_odd)
+        {
+            return false;
+        }
+
+        const float *w = &_buf[_pos]; // oldest … newest
+        float acc = 0.5f * w[CENTER];
+
+        for (uint8_t k = 0; k < TAPS; k++)
+        {
+            acc += h(k) * (w[CENTER - (2 * k + 1)] + w[CENTER + (2 * k + 1)]);
+        }
+
+        _out = acc;
+        return true;
+    }
+
+    void prime(float value)
+    {
+        for (uint8_t i = 0; i < LENGTH; i++)
+        {
+            store(value);
+        }
+
+        _odd = false; // the priming sample itself is emitted, then every second one (inputs 0, 2, 4, …)
+        _out = value;
+        _initialized = true;
+    }
+
+    void designBlackman()
+    {
+        const float span = static_cast<float>(LENGTH + 1);
+        float sum = 0.0f;
+
+        for (uint8_t k = 0; k < TAPS; k++)
+        {
+            float m = static_cast<float>(2 * k + 1);
+            float w = 0.42f + 0.5f * cosf(2.0f * PI * m / span) + 0.08f * cosf(4.0f * PI * m / span);
+            float sinc = ((k & 1) ? -1.0f : 1.0f) / (PI * m); // sin(πm/2) / (πm)
+
+            h(k) = sinc * w;
+            sum += h(k);
+        }
+
+        // Both sides of all pairs add up to 0.5, the centre tap to the other 0.5
+        for (uint8_t k = 0; k < TAPS; k++)
+        {
+            h(k) *= 0.25f / sum;
+        }
+    }
+
+protected:
+    bool checkExtra(const uint8_t *src, uint16_t len) override { return checkWindow(src, len, TAPS); }
+
+public:
+    HalfBandDecimatorFilter() : _pos(0), _odd(false), _out(0.0f), _initialized(false)
+    {
+        for (uint8_t i = 0; i < 2 * LENGTH; i++)
+        {
+            _buf[i] = 0.0f;
+        }
+
+        designBlackman();
+        setFilterType(FilterType::HALF_BAND_DECIMATOR);
+    }
+
+    ~HalfBandDecimatorFilter() {}
+
+    float apply(float value) override
+    {
+        if (!_initialized)
+        {
+            prime(value);
+            _outputReady = true;
+            return _out;
+        }
+
+        _outputReady = step(value);
+        return _out;
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        size_t emitted = 0;
+        bool ready = false;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            if (!_initialized)
+            {
+                prime(in[i]);
+                ready = true;
+            }
+            else
+            {
+                ready = step(in[i]);
+            }
+
+            if (ready)
+            {
+                out[emitted++] = _out;
+            }
+        }
+
+        if (n > 0)
+        {
+            _outputReady = ready;
+        }
+
+        return emitted;
+    }
+
+    // Coefficient of the k-th symmetric pair (offset ±(2k + 1)); restarts the filter
+    void setCoefficient(uint8_t k, float value)
+    {
+        if (k < TAPS)
+        {
+            h(k) = value;
+            reset();
+        }
+    }
+
+    float getCoefficient(uint8_t k) { return (k < TAPS) ? h(k) : 0.0f; }
+
+    void reset() { _initialized = false; }
+
+    uint16_t saveExtra(uint8_t *dst) override { return saveWindow(dst, TAPS); }
+};
+
+#endif // HALF_BAND_DECIMATOR_FILTER_H
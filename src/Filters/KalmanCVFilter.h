@@ -0,0 +1,254 @@
+#ifndef KALMANCVFILTER_H
+#define KALMANCVFILTER_H
+
+#include "BaseFilter.h"
+
+/**
+ * Two-state constant-velocity Kalman filter (position, velocity) with
+ * steady-state gains.
+ *
+ * Model: x' = x + dt·v, v' = v, white-noise acceleration with spectral
+ * density q (discrete Q = q·[dt³/3 dt²/2; dt²/2 dt]), position measured
+ * with variance R. The Riccati recursion is iterated once at configuration
+ * time (double precision) until gains and covariance are both stationary;
+ * apply() is then an alpha-beta update with those gains, no divides:
+ *     xp = x + dt·v,   e = z - xp,   x = xp + K0·e,   v = v + K1·e
+ *
+ * Drop-in for AlphaBetaFilter when the noise levels are known instead of
+ * hand-tuned α/β; getAlpha()/getBeta() report the equivalent values
+ * (α = K0, β = K1·dt). apply() returns the filtered position; the one-step
+ * prediction AlphaBetaFilter outputs is getPrediction().
+ *
+ * q must be positive: without process noise the steady state is K = 0,
+ * a filter that never follows the input. q ≤ 0 sets exactly that (no
+ * iteration) and validate() fails, so stagePipeline() refuses it.
+ *
+ * Example usage (100 Hz samples):
+ *     KalmanCVFilter kf(0.04f, 0.5f, 0.01f);   // R, q, dt
+ *     float pos = kf.apply(sample);
+ *     float rate = kf.getVelocity();
+ */
+class KalmanCVFilter : public BaseFilter
+{
+public:
+    static constexpr uint16_t MAX_RICCATI_ITERATIONS = 10000;
+
+private:
+    float &measurementNoise() { return cfg.f[0]; } // R
+    float &processNoise()     { return cfg.f[1]; } // q, acceleration spectral density
+    float &samplePeriod()     { return cfg.f[2]; } // dt
+    float &positionGain()     { return cfg.f[3]; } // K0
+    float &velocityGain()     { return cfg.f[4]; } // K1
+    float &positionVar()      { return cfg.f[5]; } // steady-state posterior P00
+    float &velocityVar()      { return cfg.f[6]; } // steady-state posterior P11
+
+    float _pos;
+    float _vel;
+    bool _initialized;
+
+    // Relative change that counts as settled; double is float on AVR
+    static constexpr double SETTLE_TOLERANCE = (sizeof(double) > sizeof(float)) ? 1e-12 : 1e-6;
+
+    static inline bool settled(double next, double previous)
+    {
+        return fabs(next - previous) <= SETTLE_TOLERANCE * fabs(next);
+    }
+
+    void updateGains()
+    {
+        const double r = measurementNoise();
+        const double q = processNoise();
+        const double dt = samplePeriod();
+
+        if (!(q > 0.0))
+        {
+            positionGain() = 0.0f;
+            velocityGain() = 0.0f;
+            positionVar() = 0.0f;
+            velocityVar() = 0.0f;
+            return;
+        }
+
+        const double q00 = q * dt * dt * dt / 3.0;
+        const double q01 = q * dt * dt / 2.0;
+        const double q11 = q * dt;
+
+        // Posterior covariance, start from a vague prior
+        double p00 = (r > 0.0) ? r : 1.0;
+        double p01 = 0.0;
+        double p11 = p00;
+        double k0 = 1.0;
+        double k1 = 0.0;
+
+        for (uint16_t it = 0; it < MAX_RICCATI_ITERATIONS; it++)
+        {
+            // Predict: F·P·Fᵀ + Q
+            const double m00 = p00 + 2.0 * dt * p01 + dt * dt * p11 + q00;
+            const double m01 = p01 + dt * p11 + q01;
+            const double m11 = p11 + q11;
+
+            // Update with H = [1 0]
+            const double s = m00 + r;
+            const double n0 = (s > 0.0) ? m00 / s : 1.0;
+            const double n1 = (s > 0.0) ? m01 / s : 0.0;
+
+            const double u00 = (1.0 - n0) * m00;
+            const double u01 = (1.0 - n0) * m01;
+            const double u11 = m11 - n1 * m01;
+
+            // Equal consecutive gains alone are not enough (q = 0 repeats 2/3, 1/3)
+            const bool done = settled(n0, k0) && settled(n1, k1) && settled(u00, p00) && settled(u01, p01) && settled(u11, p11);
+
+            p00 = u00;
+            p01 = u01;
+            p11 = u11;
+            k0 = n0;
+            k1 = n1;
+
+            if (done)
+            {
+                break;
+            }
+        }
+
+        positionGain() = static_cast<float>(k0);
+        velocityGain() = static_cast<float>(k1);
+        positionVar() = static_cast<float>(p00);
+        velocityVar() = static_cast<float>(p11);
+    }
+
+    void prime(float value)
+    {
+        _pos = value;
+        _vel = 0.0f;
+        _initialized = true;
+    }
+
+public:
+    KalmanCVFilter(float r, float q, float dt = 1.0f) : _pos(0.0f), _vel(0.0f), _initialized(false)
+    {
+        measurementNoise() = r;
+        processNoise() = q;
+        samplePeriod() = (dt > 0.0f) ? dt : 1.0f;
+        updateGains();
+        setFilterType(FilterType::KALMAN_CV);
+    }
+
+    ~KalmanCVFilter() {}
+
+    // Positive process noise, non-negative finite measurement noise
+    bool validate() const override
+    {
+        return cfg.f[1] > 0.0f && cfg.f[0] >= 0.0f && isfinite(cfg.f[0]) && isfinite(cfg.f[1]) && isfinite(cfg.f[3]) && isfinite(cfg.f[4]);
+    }
+
+    float apply(float value) override
+    {
+        if (!_initialized)
+        {
+            prime(value);
+            return value;
+        }
+
+        const float predicted = _pos + samplePeriod() * _vel;
+        const float e = value - predicted;
+
+        _pos = predicted + positionGain() * e;
+        _vel += velocityGain() * e;
+
+        return _pos;
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        size_t i = 0;
+
+        if (!_initialized)
+        {
+            prime(in[0]);
+            out[0] = _pos;
+            i = 1;
+        }
+
+        const float dt = samplePeriod();
+        const float k0 = positionGain();
+        const float k1 = velocityGain();
+        float pos = _pos;
+        float vel = _vel;
+
+        for (; i < n; i++)
+        {
+            const float predicted = pos + dt * vel;
+            const float e = in[i] - predicted;
+
+            pos = predicted + k0 * e;
+            vel += k1 * e;
+            out[i] = pos;
+        }
+
+        _pos = pos;
+        _vel = vel;
+
+        return n;
+    }
+
+    // New noise levels / sample period; gains are re-derived, state is kept
+    void setNoise(float r, float q)
+    {
+        measurementNoise() = r;
+        processNoise() = q;
+        updateGains();
+    }
+
+    void setSamplePeriod(float dt)
+    {
+        samplePeriod() = (dt > 0.0f) ? dt : 1.0f;
+        updateGains();
+    }
+
+    void reset()
+    {
+        _pos = 0.0f;
+        _vel = 0.0f;
+        _initialized = false;
+    }
+
+    bool copyStateFrom(const BaseMeasurementProcessor &other) override
+    {
+        if (!sameType(other))
+        {
+            return false;
+        }
+
+        const KalmanCVFilter &o = static_cast<const KalmanCVFilter &>(other);
+        _pos = o._pos;
+        _vel = o._vel;
+        _initialized = o._initialized;
+        return true;
+    }
+
+    float getVelocity() const { return _vel; }
+
+    // Position one sample ahead (what AlphaBetaFilter returns)
+    float getPrediction() const { return _pos + cfg.f[2] * _vel; }
+
+    float getAlpha() const { return cfg.f[3]; }
+    float getBeta() const { return cfg.f[4] * cfg.f[2]; }
+
+    // Steady-state posterior variances
+    float getErrorEstimate() const { return cfg.f[5]; }
+    float getVelocityErrorEstimate() const { return cfg.f[6]; }
+
+    bool getErrorVariance(float &variance) const override
+    {
+        variance = cfg.f[5];
+        return true;
+    }
+};
+
+#endif // KALMANCVFILTER_H
@@ -3,22 +3,105 @@
 
 #include "BaseFilter.h"
 
+/**
+ * Scalar random-walk Kalman filter (measurement noise R, process noise Q).
+ *
+ * With constant R and Q the gain converges to the steady-state solution of
+ * the Riccati equation,
+ *     P⁻∞ = (Q + sqrt(Q² + 4·Q·R)) / 2,   K∞ = P⁻∞ / (P⁻∞ + R),
+ * which is computed once in the constructor / setNoise(). GainMode selects
+ * how it is used:
+ *     EXACT         textbook update, one divide per sample
+ *     STEADY_STATE  K∞ from the first sample on: x += K∞·(z - x)
+ *     AUTO          exact update until P is within CONVERGENCE_TOL of P∞,
+ *                   then latches K∞ (same result as EXACT, no divides after
+ *                   the start-up transient)
+ *
+ * Example usage:
+ *     KalmanFilter kf(0.25f, 0.001f, KalmanFilter::AUTO);
+ *     float smooth = kf.apply(sample);
+ */
 class KalmanFilter : public BaseFilter
 {
+public:
+    enum GainMode : uint8_t
+    {
+        EXACT = 0,
+        STEADY_STATE,
+        AUTO
+    };
+
+    static constexpr float CONVERGENCE_TOL = 1e-5f; // relative |P - P∞| for AUTO to latch
+
 private:
     float &measurementNoise() { return cfg.f[0]; } // R
     float &processNoise()     { return cfg.f[1]; } // Q
+    float &steadyGain()       { return cfg.f[2]; } // K∞
+    float &steadyError()      { return cfg.f[3]; } // posterior P∞ = K∞·R
+    uint8_t &gainMode()       { return cfg.u[5]; } // GainMode
 
     float estimate;
     float error_estimate;
     bool initialized;
+    bool converged; // K∞ in use (STEADY_STATE, or AUTO after latching)
+
+    void updateSteadyState()
+    {
+        const double r = measurementNoise();
+        const double q = processNoise();
+        const double prior = 0.5 * (q + sqrt(q * q + 4.0 * q * r));
+        const double k = (prior + r > 0.0) ? prior / (prior + r) : 1.0;
+
+        steadyGain() = static_cast<float>(k);
+        steadyError() = static_cast<float>(k * r);
+    }
+
+    void prime(float value)
+    {
+        estimate = value;
+        initialized = true;
+
+        if (gainMode() == STEADY_STATE)
+        {
+            error_estimate = steadyError();
+            converged = true;
+        }
+    }
+
+    // One exact step; AUTO latches K∞ once P has settled
+    inline float exactStep(float value, float r, float q)
+    {
+        error_estimate += q;
+
+        float kalman_gain = error_estimate / (error_estimate + r);
+        estimate += kalman_gain * (value - estimate);
+        error_estimate *= (1.0f - kalman_gain);
+
+        if (gainMode() == AUTO && fabsf(error_estimate - steadyError()) <= CONVERGENCE_TOL * steadyError())
+        {
+            error_estimate = steadyError();
+            converged = true;
+        }
+
+        return estimate;
+    }
+
+protected:
+    // K∞ and P∞ come with cfg; AUTO re-converges from the current P
+    bool loadExtra(const uint8_t * /*src*/, uint16_t /*len*/) override
+    {
+        setGainMode(getGainMode());
+        return true;
+    }
 
 public:
-    KalmanFilter(float r, float q)
-        : estimate(0.0f), error_estimate(1.0f), initialized(false)
+    KalmanFilter(float r, float q, GainMode mode = EXACT)
+        : estimate(0.0f), error_estimate(1.0f), initialized(false), converged(false)
     {
         measurementNoise() = r;
         processNoise() = q;
+        gainMode() = mode;
+        updateSteadyState();
         setFilterType(FilterType::KALMAN); // Add this enum value to your system
     }
 
@@ -28,21 +111,122 @@ public:
     {
         if (!initialized)
         {
-            estimate = value;
-            initialized = true;
+            prime(value);
             return value;
         }
 
-        // Prediction update
-        error_estimate += processNoise();
+        if (converged)
+        {
+            estimate += steadyGain() * (value - estimate);
+            return estimate;
+        }
 
-        // Measurement update
-        float kalman_gain = error_estimate / (error_estimate + measurementNoise());
-        estimate += kalman_gain * (value - estimate);
-        error_estimate *= (1.0f - kalman_gain);
+        return exactStep(value, measurementNoise(), processNoise());
+    }
 
-        return estimate;
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        size_t i = 0;
+
+        if (!initialized)
+        {
+            prime(in[0]);
+            out[0] = estimate;
+            i = 1;
+        }
+
+        const float r = measurementNoise();
+        const float q = processNoise();
+
+        // Exact updates until converged (never, in EXACT mode) ...
+        for (; i < n && !converged; i++)
+        {
+            out[i] = exactStep(in[i], r, q);
+        }
+
+        // ... then a plain multiply-add per sample
+        const float k = steadyGain();
+        float x = estimate;
+
+        for (; i < n; i++)
+        {
+            x += k * (in[i] - x);
+            out[i] = x;
+        }
+
+        estimate = x;
+
+        return n;
     }
+
+    // New R and Q; the steady-state gain is recomputed and AUTO re-converges
+    void setNoise(float r, float q)
+    {
+        measurementNoise() = r;
+        processNoise() = q;
+        updateSteadyState();
+        converged = initialized && gainMode() == STEADY_STATE;
+
+        if (converged)
+        {
+            error_estimate = steadyError();
+        }
+    }
+
+    void setGainMode(GainMode mode)
+    {
+        gainMode() = mode;
+        converged = initialized && mode == STEADY_STATE;
+
+        if (converged)
+        {
+            error_estimate = steadyError();
+        }
+    }
+
+    void reset()
+    {
+        estimate = 0.0f;
+        error_estimate = 1.0f;
+        initialized = false;
+        converged = false;
+    }
+
+    // Estimate and P carry over; the gain follows this filter's own R, Q and mode
+    bool copyStateFrom(const BaseMeasurementProcessor &other) override
+    {
+        if (!sameType(other))
+        {
+            return false;
+        }
+
+        const KalmanFilter &o = static_cast<const KalmanFilter &>(other);
+        estimate = o.estimate;
+        error_estimate = o.error_estimate;
+        initialized = o.initialized;
+        setGainMode(getGainMode());
+        return true;
+    }
+
+    GainMode getGainMode() const { return static_cast<GainMode>(cfg.u[5]); }
+
+    // Current posterior variance P (P∞ once converged)
+    float getErrorEstimate() const { return error_estimate; }
+
+    bool getErrorVariance(float &variance) const override
+    {
+        variance = error_estimate;
+        return true;
+    }
+
+    float getSteadyStateGain() const { return cfg.f[2]; }
+
+    bool isConverged() const { return converged; }
 };
 
 #endif // KALMANFILTER_H
@@ -32,6 +32,22 @@ public:
         return median(values[0], values[1], values[2]);
     }
 
+    bool copyStateFrom(const BaseMeasurementProcessor &other) override
+    {
+        if (!sameType(other))
+        {
+            return false;
+        }
+
+        const Median3Filter &o = static_cast<const Median3Filter &>(other);
+        values[0] = o.values[0];
+        values[1] = o.values[1];
+        values[2] = o.values[2];
+        index = o.index;
+        initialized = o.initialized;
+        return true;
+    }
+
 private:
     float median(float a, float b, float c)
     {
@@ -0,0 +1,179 @@
+#ifndef MOVING_MIN_MAX_FILTER_H
+#define MOVING_MIN_MAX_FILTER_H
+
+#include "BaseFilter.h"
+
+/**
+ * Minimum, maximum or mid-range of the last W samples in O(1) amortised.
+ *
+ * Two monotonic deques (Lemire's streaming min/max):
+ * the min deque keeps the candidates that can still become the window
+ * minimum, in increasing order; every sample is pushed and popped at most
+ * once. Both extremes are always tracked, so getMin()/getMax() are
+ * available whatever apply() returns.
+ *
+ * Storage is template-sized inside the filter (no heap). The first sample
+ * fills the whole window.
+ *
+ * Example usage:
+ *     MovingMinMaxFilter<32> env(MovingMinMaxFilter<32>::WINDOW_MAX);
+ *     float peak = env.apply(raw);
+ *     float spread = env.getMax() - env.getMin();
+ */
+template <uint8_t W>
+class MovingMinMaxFilter : public BaseFilter
+{
+    static_assert(W >= 1, "MovingMinMaxFilter needs a window of at least one sample");
+
+public:
+    enum OutputMode : uint8_t
+    {
+        WINDOW_MIN = 0,
+        WINDOW_MAX,
+        WINDOW_MID // (min + max) / 2
+    };
+
+private:
+    // Monotonic deque over a ring of W (sample number, value) entries
+    struct Deque
+    {
+        uint32_t t[W];
+        float v[W];
+        uint8_t head;
+        uint8_t count;
+
+        void clear() { head = 0; count = 0; }
+
+        inline uint8_t slot(uint8_t i) const { return (head + i < W) ? head + i : head + i - W; }
+
+        inline float front() const { return v[head]; }
+
+        // Drop entries older than the window, then those dominated by x
+        // (sample >= x for the min deque, <= x for the max deque)
+        template <bool IS_MIN>
+        inline void push(uint32_t now, float x)
+        {
+            if (count > 0 && now - t[head] >= W)
+            {
+                head = (head + 1 < W) ? head + 1 : 0;
+                count--;
+            }
+
+            while (count > 0)
+            {
+                float back = v[slot(count - 1)];
+
+                if (IS_MIN ? (back < x) : (back > x))
+                {
+                    break;
+                }
+
+                count--;
+            }
+
+            uint8_t s = slot(count);
+            t[s] = now;
+            v[s] = x;
+            count++;
+        }
+    };
+
+    inline uint8_t &mode() { return cfg.u[5]; } // OutputMode
+
+    Deque _min;
+    Deque _max;
+    uint32_t _n;
+    bool _initialized;
+
+    inline float output()
+    {
+        switch (mode())
+        {
+        case WINDOW_MAX:
+            return _max.front();
+        case WINDOW_MID:
+            return 0.5f * (_min.front() + _max.front());
+        default:
+            return _min.front();
+        }
+    }
+
+    inline float step(float x)
+    {
+        _n++;
+        _min.template push<true>(_n, x);
+        _max.template push<false>(_n, x);
+        return output();
+    }
+
+    void prime(float x)
+    {
+        _min.clear();
+        _max.clear();
+        _n = 0;
+
+        // A constant window collapses to one entry per deque
+        _min.template push<true>(_n, x);
+        _max.template push<false>(_n, x);
+
+        _initialized = true;
+    }
+
+protected:
+    bool checkExtra(const uint8_t *src, uint16_t len) override { return checkWindow(src, len, W); }
+
+public:
+    explicit MovingMinMaxFilter(OutputMode m = WINDOW_MIN) : _n(0), _initialized(false)
+    {
+        _min.clear();
+        _max.clear();
+        mode() = m;
+        setFilterType(FilterType::MOVING_MIN_MAX);
+    }
+
+    ~MovingMinMaxFilter() {}
+
+    float apply(float value) override
+    {
+        if (!_initialized)
+        {
+            prime(value);
+            return value;
+        }
+
+        return step(value);
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        size_t i = 0;
+
+        if (n > 0 && !_initialized)
+        {
+            prime(in[0]);
+            out[0] = in[0];
+            i = 1;
+        }
+
+        for (; i < n; i++)
+        {
+            out[i] = step(in[i]);
+        }
+
+        return n;
+    }
+
+    void setMode(OutputMode m) { mode() = m; }
+
+    // Extremes of the current window (0 before the first sample)
+    float getMin() const { return _initialized ? _min.front() : 0.0f; }
+    float getMax() const { return _initialized ? _max.front() : 0.0f; }
+
+    void reset() { _initialized = false; }
+
+    uint16_t saveExtra(uint8_t *dst) override { return saveWindow(dst, W); }
+
+    static constexpr uint8_t window() { return W; }
+};
+
+#endif // MOVING_MIN_MAX_FILTER_H
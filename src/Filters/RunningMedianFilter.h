@@ -0,0 +1,225 @@
+#ifndef RUNNING_MEDIAN_FILTER_H
+#define RUNNING_MEDIAN_FILTER_H
+
+#include "BaseFilter.h"
+
+/**
+ * Median of the last W samples (W odd, 3 … 255) in O(log W) per sample.
+ *
+ * Double heap around the median: a max-heap of the lower half and a
+ * min-heap of the upper half share one index array whose centre slot is the
+ * median. Every sample position in the ring buffer knows its heap slot, so
+ * the sample leaving the window is overwritten in place and sifted up or
+ * down one heap; no sorting, no search.
+ *
+ * Heap slots are signed: k < 0 max-heap, k == 0 median, k > 0 min-heap,
+ * children of k are 2k and 2k ± 1, the parent is k / 2.
+ *
+ * All storage is template-sized inside the filter (no heap allocation).
+ * The first sample fills the whole window.
+ *
+ * Example usage:
+ *     RunningMedianFilter<15> med;
+ *     float clean = med.apply(raw);   // rejects bursts of up to 7 outliers
+ */
+template <uint8_t W>
+class RunningMedianFilter : public BaseFilter
+{
+    static_assert(W >= 3 && (W & 1), "RunningMedianFilter needs an odd window of at least 3 samples");
+
+private:
+    static constexpr int16_t HALF = W / 2; // Entries per heap
+
+    float _data[W];          // Ring buffer of samples
+    int16_t _pos[W];         // Heap slot of each ring entry
+    uint8_t _heapBuf[W];     // Ring index per heap slot, centre = median
+    uint8_t _idx;
+    bool _initialized;
+
+    inline uint8_t &heap(int16_t k) { return _heapBuf[k + HALF]; }
+
+    inline bool less(int16_t i, int16_t j) { return _data[heap(i)] < _data[heap(j)]; }
+
+    inline void exchange(int16_t i, int16_t j)
+    {
+        uint8_t t = heap(i);
+        heap(i) = heap(j);
+        heap(j) = t;
+
+        _pos[heap(i)] = i;
+        _pos[heap(j)] = j;
+    }
+
+    // Swap if slot i holds a smaller value than slot j
+    inline bool cmpExchange(int16_t i, int16_t j)
+    {
+        if (less(i, j))
+        {
+            exchange(i, j);
+            return true;
+        }
+
+        return false;
+    }
+
+    // Sift down the min-heap starting at child slot i
+    void minSortDown(int16_t i)
+    {
+        for (; i <= HALF; i *= 2)
+        {
+            if (i > 1 && i < HALF && less(i + 1, i))
+            {
+                ++i;
+            }
+
+            if (!cmpExchange(i, i / 2))
+            {
+                break;
+            }
+        }
+    }
+
+    // Sift down the max-heap starting at child slot i
+    void maxSortDown(int16_t i)
+    {
+        for (; i >= -HALF; i *= 2)
+        {
+            if (i < -1 && i > -HALF && less(i, i - 1))
+            {
+                --i;
+            }
+
+            if (!cmpExchange(i / 2, i))
+            {
+                break;
+            }
+        }
+    }
+
+    // Sift up; true if the value reached the median slot
+    bool minSortUp(int16_t i)
+    {
+        while (i > 0 && cmpExchange(i, i / 2))
+        {
+            i /= 2;
+        }
+
+        return i == 0;
+    }
+
+    bool maxSortUp(int16_t i)
+    {
+        while (i < 0 && cmpExchange(i / 2, i))
+        {
+            i /= 2;
+        }
+
+        return i == 0;
+    }
+
+    void prime(float x)
+    {
+        for (uint8_t i = 0; i < W; i++)
+        {
+            _data[i] = x;
+
+            // 0, -1, 1, -2, 2, ...: any layout is a valid heap for equal values
+            int16_t k = (i + 1) / 2;
+            _pos[i] = (i & 1) ? -k : k;
+            heap(_pos[i]) = i;
+        }
+
+        _idx = 0;
+        _initialized = true;
+    }
+
+    inline float step(float v)
+    {
+        const int16_t p = _pos[_idx];
+        const float old = _data[_idx];
+
+        _data[_idx] = v;
+        _idx = (_idx + 1 < W) ? _idx + 1 : 0;
+
+        if (p > 0) // replaced value sits in the min-heap
+        {
+            if (old < v)
+            {
+                minSortDown(p * 2);
+            }
+            else if (minSortUp(p))
+            {
+                maxSortDown(-1);
+            }
+        }
+        else if (p < 0) // in the max-heap
+        {
+            if (v < old)
+            {
+                maxSortDown(p * 2);
+            }
+            else if (maxSortUp(p))
+            {
+                minSortDown(1);
+            }
+        }
+        else // the median itself was replaced
+        {
+            maxSortDown(-1);
+            minSortDown(1);
+        }
+
+        return _data[heap(0)];
+    }
+
+protected:
+    bool checkExtra(const uint8_t *src, uint16_t len) override { return checkWindow(src, len, W); }
+
+public:
+    RunningMedianFilter() : _idx(0), _initialized(false)
+    {
+        prime(0.0f);
+        _initialized = false;
+        setFilterType(FilterType::RUNNING_MEDIAN);
+    }
+
+    ~RunningMedianFilter() {}
+
+    float apply(float value) override
+    {
+        if (!_initialized)
+        {
+            prime(value);
+            return value;
+        }
+
+        return step(value);
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        size_t i = 0;
+
+        if (n > 0 && !_initialized)
+        {
+            prime(in[0]);
+            out[0] = in[0];
+            i = 1;
+        }
+
+        for (; i < n; i++)
+        {
+            out[i] = step(in[i]);
+        }
+
+        return n;
+    }
+
+    void reset() { _initialized = false; }
+
+    uint16_t saveExtra(uint8_t *dst) override { return saveWindow(dst, W); }
+
+    static constexpr uint8_t window() { return W; }
+};
+
+#endif // RUNNING_MEDIAN_FILTER_H
@@ -0,0 +1,131 @@
+#ifndef SMA_FILTER_H
+#define SMA_FILTER_H
+
+#include "BaseFilter.h"
+
+/**
+ * Simple moving average over the last W samples.
+ *
+ * O(1) per sample: ring buffer plus running sum (add the new sample,
+ * subtract the one leaving the window). The running sum picks up rounding
+ * error with every update, so it is recomputed from the buffer with Kahan
+ * summation once per W samples, O(1) amortised.
+ *
+ * The window is a template parameter, so the buffer lives inside the filter
+ * object (no heap). The first sample fills the whole window.
+ *
+ * Example usage:
+ *     SMAFilter<16> sma;
+ *     float smooth = sma.apply(raw);
+ */
+template <uint8_t W>
+class SMAFilter : public BaseFilter
+{
+    static_assert(W >= 1, "SMAFilter needs a window of at least one sample");
+
+private:
+    inline float &invWindow() { return cfg.f[0]; }
+
+    float _buf[W];
+    float _sum;
+    uint8_t _idx;
+    bool _initialized;
+
+    void prime(float x)
+    {
+        for (uint8_t i = 0; i < W; i++)
+        {
+            _buf[i] = x;
+        }
+
+        _idx = 0;
+        resync();
+        _initialized = true;
+    }
+
+    // Exact (compensated) sum of the window, clears accumulated drift
+    void resync()
+    {
+        float sum = 0.0f;
+        float comp = 0.0f;
+
+        for (uint8_t i = 0; i < W; i++)
+        {
+            float y = _buf[i] - comp;
+            float t = sum + y;
+            comp = (t - sum) - y;
+            sum = t;
+        }
+
+        _sum = sum;
+    }
+
+    inline float step(float x)
+    {
+        _sum += x - _buf[_idx];
+        _buf[_idx] = x;
+
+        if (++_idx == W)
+        {
+            _idx = 0;
+            resync();
+        }
+
+        return _sum * invWindow();
+    }
+
+protected:
+    bool checkExtra(const uint8_t *src, uint16_t len) override { return checkWindow(src, len, W); }
+
+public:
+    SMAFilter() : _sum(0.0f), _idx(0), _initialized(false)
+    {
+        for (uint8_t i = 0; i < W; i++)
+        {
+            _buf[i] = 0.0f;
+        }
+
+        invWindow() = 1.0f / W;
+        setFilterType(FilterType::SIMPLE_MOVING_AVERAGE);
+    }
+
+    ~SMAFilter() {}
+
+    float apply(float value) override
+    {
+        if (!_initialized)
+        {
+            prime(value);
+            return value;
+        }
+
+        return step(value);
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        size_t i = 0;
+
+        if (n > 0 && !_initialized)
+        {
+            prime(in[0]);
+            out[0] = in[0];
+            i = 1;
+        }
+
+        for (; i < n; i++)
+        {
+            out[i] = step(in[i]);
+        }
+
+        return n;
+    }
+
+    void reset() { _initialized = false; }
+
+    uint16_t saveExtra(uint8_t *dst) override { return saveWindow(dst, W); }
+
+    static constexpr uint8_t window() { return W; }
+};
+
+#endif // SMA_FILTER_H
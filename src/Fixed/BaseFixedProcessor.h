@@ -0,0 +1,51 @@
+#ifndef BASE_FIXED_PROCESSOR_H
+#define BASE_FIXED_PROCESSOR_H
+
+#include <Arduino.h>
+#include "FixedPoint.h"
+
+/**
+ * Integer counterpart of BaseMeasurementProcessor for targets without FPU.
+ *
+ * Stages take and return int32_t in whatever Q-format the chain agrees on
+ * (e.g. raw ADC counts in, m°C or Q16 °C out); each stage documents its
+ * formats. apply() never touches float.
+ */
+class BaseFixedProcessor
+{
+public:
+    enum FixedType : uint8_t
+    {
+        NONE = 0,
+        FIXED_EMA,
+        FIXED_POLYNOMIAL,
+        FIXED_PIECEWISE_LINEAR,
+        FIXED_LOOKUP_TABLE
+    };
+
+protected:
+    FixedType _type;
+
+    void setFixedType(FixedType type) { _type = type; }
+
+public:
+    BaseFixedProcessor() : _type(NONE) {}
+
+    virtual ~BaseFixedProcessor() {}
+    virtual int32_t apply(int32_t value) = 0;
+
+    // Block variant of apply(), in and out may alias; returns samples written
+    virtual size_t applyBlock(const int32_t *in, int32_t *out, size_t n)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = apply(in[i]);
+        }
+
+        return n;
+    }
+
+    FixedType getFixedType() const { return _type; }
+};
+
+#endif // BASE_FIXED_PROCESSOR_H
@@ -0,0 +1,110 @@
+#ifndef FIXED_EMA_FILTER_H
+#define FIXED_EMA_FILTER_H
+
+#include "BaseFixedProcessor.h"
+
+/**
+ * Integer EMA: y += α·(x - y), α in Q15.
+ *
+ * The state carries extra fractional guard bits, so small steps of slow
+ * filters are not lost to rounding (a plain integer EMA would stick up to
+ * 1/(2α) LSB away from a constant input). By default the guard is the
+ * smallest that keeps that residual below 0.5 LSB, i.e. 2^guard ≥ 1/α.
+ * The update is two 16×32-bit multiplies (FixedMath::mulQ15), no 64-bit
+ * arithmetic.
+ *
+ * Input and output share one Q-format; |x| must stay below 2^(30 - guard).
+ *
+ * Example usage:
+ *     FixedEMAFilter ema(FixedMath::q15(0.1f));   // α folded at compile time
+ *     int32_t smooth = ema.apply(adcCounts);
+ */
+class FixedEMAFilter : public BaseFixedProcessor
+{
+public:
+    static constexpr uint8_t AUTO_GUARD = 0xFF;
+
+private:
+    int16_t _alpha;  // Q15
+    uint8_t _guard;
+    bool _autoGuard;
+    int32_t _state;  // y · 2^guard
+    bool _initialized;
+
+    // Smallest g with α·2^g ≥ 1 (α in Q15)
+    static uint8_t guardFor(int16_t alphaQ15)
+    {
+        uint8_t g = 0;
+
+        while (g < 15 && (static_cast<int32_t>(alphaQ15) << g) < 32768)
+        {
+            g++;
+        }
+
+        return g;
+    }
+
+public:
+    explicit FixedEMAFilter(int16_t alphaQ15 = 32767, uint8_t guardBits = AUTO_GUARD)
+        : _alpha(32767), _guard(0), _autoGuard(guardBits == AUTO_GUARD), _state(0), _initialized(false)
+    {
+        if (!_autoGuard)
+        {
+            _guard = (guardBits > 15) ? 15 : guardBits;
+        }
+
+        setAlpha(alphaQ15);
+        setFixedType(FixedType::FIXED_EMA);
+    }
+
+    ~FixedEMAFilter() {}
+
+    int32_t apply(int32_t value) override
+    {
+        int32_t x = value * (static_cast<int32_t>(1) << _guard);
+
+        if (!_initialized)
+        {
+            _state = x;
+            _initialized = true;
+        }
+        else
+        {
+            _state += FixedMath::mulQ15(x - _state, _alpha);
+        }
+
+        return FixedMath::roundShift(_state, _guard);
+    }
+
+    size_t applyBlock(const int32_t *in, int32_t *out, size_t n) override
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = apply(in[i]);
+        }
+
+        return n;
+    }
+
+    // α in Q15, 1 … 32767 (≈ 3e-5 … 1); with the automatic guard the state
+    // is rescaled, so α can change on a running filter
+    void setAlpha(int16_t alphaQ15)
+    {
+        _alpha = (alphaQ15 < 1) ? 1 : alphaQ15;
+
+        if (_autoGuard)
+        {
+            const uint8_t g = guardFor(_alpha);
+
+            _state = (g >= _guard) ? _state * (static_cast<int32_t>(1) << (g - _guard)) : FixedMath::roundShift(_state, _guard - g);
+            _guard = g;
+        }
+    }
+
+    int16_t getAlpha() const { return _alpha; }
+    uint8_t getGuardBits() const { return _guard; }
+
+    void reset() { _initialized = false; }
+};
+
+#endif // FIXED_EMA_FILTER_H
@@ -0,0 +1,148 @@
+#ifndef FIXED_LOOKUP_TABLE_H
+#define FIXED_LOOKUP_TABLE_H
+
+#include "BaseFixedProcessor.h"
+#include "BaseMeasurementProcessor.h"
+
+/**
+ * Input:  integer x (e.g. ADC counts) inside [xStart, xStart + (size - 1)·2^shift]
+ * Output: table value, linearly interpolated, int32_t in the table's format
+ *
+ * Uniform grid with a power-of-two step: index and fraction come from one
+ * subtract, one shift and one mask; the interpolation is one multiply and
+ * one shift. This is the integer RTD path: sample RTD385 (or any float
+ * mapper) once at setup, or wrap a table frozen into flash with
+ * printTable(); apply() never touches float. Inputs outside the grid clamp
+ * to the table ends.
+ *
+ * The interpolation product stays 32-bit when every step between
+ * neighbouring entries satisfies |Δ|·2^shift < 2^31; otherwise the table
+ * switches to a 64-bit product (checked at construction).
+ *
+ * Example usage (Pt100 on a 16-bit ratiometric ADC, R = counts · 400 Ω / 65536, m°C out):
+ *     RTD385 rtd(100.0f);
+ *     static int32_t lut[257];
+ *     FixedLookupTable fast(rtd, 0, 8, lut, 257, 400.0f / 65536.0f, 0.0f, 1000.0f);
+ *     int32_t mC = fast.apply(adcCounts);
+ */
+class FixedLookupTable : public BaseFixedProcessor
+{
+private:
+    const int32_t *_table;
+    uint16_t _size;
+    uint8_t _shift;
+    bool _progmem;
+    bool _wide;    // 64-bit interpolation product needed
+    int32_t _x0;
+    int32_t _span; // (size - 1) · 2^shift
+
+    inline int32_t sample(uint16_t i) const
+    {
+        return _progmem ? static_cast<int32_t>(pgm_read_dword(&_table[i])) : _table[i];
+    }
+
+    void init()
+    {
+        _span = (_size >= 2) ? static_cast<int32_t>(_size - 1) << _shift : 0;
+        _wide = false;
+
+        for (uint16_t i = 0; i + 1 < _size; i++)
+        {
+            int64_t d = static_cast<int64_t>(sample(i + 1)) - sample(i);
+            if (d < 0) { d = -d; }
+
+            if ((d << _shift) >= (1LL << 31))
+            {
+                _wide = true;
+                break;
+            }
+        }
+
+        setFixedType(FixedType::FIXED_LOOKUP_TABLE);
+    }
+
+public:
+    /**
+     * Sample source at x = xStart + i·2^shift, i < size, into buffer.
+     * source sees x·inScale + inOffset (e.g. counts → Ω) and its result is
+     * stored as round(f·outScale) (e.g. 1000 for m°C). Float is used here only.
+     */
+    FixedLookupTable(BaseMeasurementProcessor &source, int32_t xStart, uint8_t shift, int32_t *buffer, uint16_t size,
+                     float inScale = 1.0f, float inOffset = 0.0f, float outScale = 1.0f)
+        : _table(buffer), _size(size), _shift(shift > 30 ? 30 : shift), _progmem(false), _wide(false), _x0(xStart), _span(0)
+    {
+        for (uint16_t i = 0; i < _size; i++)
+        {
+            double x = static_cast<double>(xStart) + ldexp(static_cast<double>(i), _shift);
+            buffer[i] = FixedMath::fromDouble(source.apply(static_cast<float>(x * inScale + inOffset)) * static_cast<double>(outScale), 0);
+        }
+
+        init();
+    }
+
+    // Wrap a pre-sampled table; inProgmem selects pgm_read_dword() access
+    FixedLookupTable(const int32_t *table, uint16_t size, int32_t xStart, uint8_t shift, bool inProgmem = true)
+        : _table(table), _size(size), _shift(shift > 30 ? 30 : shift), _progmem(inProgmem), _wide(false), _x0(xStart), _span(0)
+    {
+        init();
+    }
+
+    ~FixedLookupTable() {}
+
+    int32_t apply(int32_t value) override
+    {
+        if (_size < 2)
+        {
+            return _size ? sample(0) : value;
+        }
+
+        int32_t d = value - _x0;
+
+        if (d <= 0)
+        {
+            return sample(0);
+        }
+
+        if (d >= _span)
+        {
+            return sample(_size - 1);
+        }
+
+        uint16_t i = static_cast<uint16_t>(d >> _shift);
+        int32_t frac = d & ((static_cast<int32_t>(1) << _shift) - 1);
+        int32_t y0 = sample(i);
+        int32_t dy = sample(i + 1) - y0;
+
+        if (_wide)
+        {
+            return y0 + static_cast<int32_t>(FixedMath::roundShift64(static_cast<int64_t>(dy) * frac, _shift));
+        }
+
+        return y0 + FixedMath::roundShift(dy * frac, _shift);
+    }
+
+    uint16_t getSize() const { return _size; }
+    int32_t getXStart() const { return _x0; }
+    int32_t getXEnd() const { return _x0 + _span; }
+
+    // Emit the table as a PROGMEM C array, e.g. to freeze a sampled table into flash
+    void printTable(Print &out, const char *name) const
+    {
+        out.print("static const int32_t ");
+        out.print(name);
+        out.print("[");
+        out.print(static_cast<unsigned>(_size));
+        out.println("] PROGMEM = {");
+
+        for (uint16_t i = 0; i < _size; i++)
+        {
+            out.print("    ");
+            out.print(static_cast<long>(sample(i)));
+            out.println((i + 1 < _size) ? "," : "");
+        }
+
+        out.println("};");
+    }
+};
+
+#endif // FIXED_LOOKUP_TABLE_H
@@ -0,0 +1,150 @@
+#ifndef FIXED_PIECEWISE_LINEAR_TABLE_H
+#define FIXED_PIECEWISE_LINEAR_TABLE_H
+
+#include "BaseFixedProcessor.h"
+
+/**
+ * Integer piecewise-linear calibration table with up to N points.
+ *
+ * x and f(x) are plain int32_t in the caller's formats (e.g. ADC counts →
+ * m°C). Segment slopes are cached in Q16 on every edit, so apply() is a
+ * binary search plus one multiply, no divide. Inputs outside the table
+ * extrapolate along the outer segments, like PiecewiseLinearTable.
+ *
+ * Example usage:
+ *     FixedPiecewiseLinearTable<> table;
+ *     table.pushPoint(1024, -50000);   // counts, m°C
+ *     table.pushPoint(2048,  25000);
+ *     table.pushPoint(3072, 105000);
+ *     int32_t mC = table.apply(adcCounts);
+ */
+template <uint8_t N = 16>
+class FixedPiecewiseLinearTable : public BaseFixedProcessor
+{
+    static_assert(N >= 2, "FixedPiecewiseLinearTable needs room for at least two points");
+
+public:
+    static constexpr uint8_t SLOPE_FRAC = 16;
+
+private:
+    int32_t _x[N];
+    int32_t _fx[N];
+    int32_t _slope[N - 1]; // Q16, segment i between points i and i + 1
+    uint8_t _size;
+
+    void updateSlopes()
+    {
+        for (uint8_t i = 0; i + 1 < _size; i++)
+        {
+            int64_t dx = static_cast<int64_t>(_x[i + 1]) - _x[i];
+            int64_t dy = static_cast<int64_t>(_fx[i + 1]) - _fx[i];
+
+            _slope[i] = dx ? FixedMath::saturate((dy * (1LL << SLOPE_FRAC)) / dx) : 0;
+        }
+    }
+
+    // First point index pos in [1, size - 1] with x[pos] >= value
+    inline uint8_t findSegment(int32_t value) const
+    {
+        uint8_t lo = 1;
+        uint8_t hi = _size - 1;
+
+        while (lo < hi)
+        {
+            uint8_t mid = (lo + hi) >> 1;
+
+            if (_x[mid] < value)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        return lo;
+    }
+
+public:
+    FixedPiecewiseLinearTable() : _size(0)
+    {
+        for (uint8_t i = 0; i < N; i++)
+        {
+            _x[i] = 0;
+            _fx[i] = 0;
+        }
+
+        for (uint8_t i = 0; i + 1 < N; i++)
+        {
+            _slope[i] = 0;
+        }
+
+        setFixedType(FixedType::FIXED_PIECEWISE_LINEAR);
+    }
+
+    ~FixedPiecewiseLinearTable() {}
+
+    int32_t apply(int32_t value) override
+    {
+        if (_size < 2)
+        {
+            return _size ? _fx[0] : value;
+        }
+
+        uint8_t pos = findSegment(value) - 1;
+        int64_t dx = static_cast<int64_t>(value) - _x[pos];
+
+        return FixedMath::saturate(_fx[pos] + FixedMath::roundShift64(dx * _slope[pos], SLOPE_FRAC));
+    }
+
+    // Sorted insert: O(n) shift instead of re-sorting the whole table
+    bool pushPoint(int32_t xValue, int32_t fxValue)
+    {
+        if (_size >= N)
+        {
+            return false;
+        }
+
+        uint8_t pos = _size;
+
+        while (pos > 0 && _x[pos - 1] > xValue)
+        {
+            _x[pos] = _x[pos - 1];
+            _fx[pos] = _fx[pos - 1];
+            pos--;
+        }
+
+        _x[pos] = xValue;
+        _fx[pos] = fxValue;
+        _size++;
+
+        updateSlopes();
+        return true;
+    }
+
+    bool deletePoint(uint8_t idx)
+    {
+        if (idx >= _size)
+        {
+            return false;
+        }
+
+        for (uint8_t i = idx; i + 1 < _size; i++)
+        {
+            _x[i] = _x[i + 1];
+            _fx[i] = _fx[i + 1];
+        }
+
+        _size--;
+
+        updateSlopes();
+        return true;
+    }
+
+    uint8_t getSize() const { return _size; }
+    int32_t getX(uint8_t idx) const { return (idx < _size) ? _x[idx] : 0; }
+    int32_t getFX(uint8_t idx) const { return (idx < _size) ? _fx[idx] : 0; }
+};
+
+#endif // FIXED_PIECEWISE_LINEAR_TABLE_H
@@ -0,0 +1,66 @@
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <Arduino.h>
+
+/**
+ * Q-format helpers for the integer pipeline (FixedSensor and Fixed* stages).
+ *
+ * Runtime paths only use integer adds, shifts and multiplies; the float
+ * conversions are meant for configuration (setup) or constant expressions,
+ * where the compiler folds them away.
+ */
+struct FixedMath
+{
+    // Float → Q15 / Q-frac, rounded and saturated (configuration time)
+    static constexpr int16_t q15(float v)
+    {
+        return (v >= 32767.0f / 32768.0f) ? 32767 : (v <= -1.0f) ? -32768 : static_cast<int16_t>(v * 32768.0f + (v >= 0.0f ? 0.5f : -0.5f));
+    }
+
+    // double is float on AVR; fine for configuration values
+    static int32_t fromDouble(double v, uint8_t frac)
+    {
+        double x = ldexp(v, frac);
+
+        if (x >= 2147483647.0) { return INT32_MAX; }
+        if (x <= -2147483648.0) { return INT32_MIN; }
+
+        return static_cast<int32_t>((x >= 0.0) ? x + 0.5 : x - 0.5);
+    }
+
+    static int32_t fromFloat(float v, uint8_t frac) { return fromDouble(v, frac); }
+
+    static float toFloat(int32_t v, uint8_t frac) { return ldexp(static_cast<double>(v), -frac); }
+
+    static inline int32_t saturate(int64_t v)
+    {
+        return (v > INT32_MAX) ? INT32_MAX : (v < INT32_MIN) ? INT32_MIN : static_cast<int32_t>(v);
+    }
+
+    // a · b / 2^15 without a 64-bit product: split a into high and low 15 bits
+    // (the low part is rounded, the result is within 1 LSB of the exact product)
+    static inline int32_t mulQ15(int32_t a, int16_t b)
+    {
+        return (a >> 15) * b + (((a & 0x7FFF) * b + 0x4000) >> 15);
+    }
+
+    // a · b / 2^31, rounded (one 32×32→64 multiply)
+    static inline int32_t mulQ31(int32_t a, int32_t b)
+    {
+        return static_cast<int32_t>((static_cast<int64_t>(a) * b + (1LL << 30)) >> 31);
+    }
+
+    // v / 2^s rounded to nearest, s may be 0
+    static inline int32_t roundShift(int32_t v, uint8_t s)
+    {
+        return s ? (v + (1L << (s - 1))) >> s : v;
+    }
+
+    static inline int64_t roundShift64(int64_t v, uint8_t s)
+    {
+        return s ? (v + (1LL << (s - 1))) >> s : v;
+    }
+};
+
+#endif // FIXED_POINT_H
@@ -0,0 +1,117 @@
+#ifndef FIXED_POLYNOMIAL_MAPPER_H
+#define FIXED_POLYNOMIAL_MAPPER_H
+
+#include "BaseFixedProcessor.h"
+
+/**
+ * Input:  integer x with |x| < 2^INPUT_BITS (e.g. ADC counts)
+ * Output: p(x) in Q(OUT_FRAC) (e.g. OUT_FRAC = 0 with p in m°C)
+ *
+ * Horner evaluation in Q31 on a normalised input u = x / 2^INPUT_BITS:
+ *     p(x) = 2^E · Σ q_k·u^k,   q_k = c_k · 2^(k·INPUT_BITS - E)
+ * E is chosen at configuration time so that every Horner partial sum stays
+ * below 1, so the runtime needs no overflow checks: one Q31 multiply and
+ * one add per degree, plus a final shift into the output format.
+ *
+ * setPolynomial() converts the floating-point coefficients once; apply() is
+ * integer only (32×32→64-bit multiplies).
+ *
+ * Example usage (12-bit ADC → m°C):
+ *     static const float c[] = { -245956.2f, 2360.65f, 0.9891f };
+ *     FixedPolynomialMapper poly;
+ *     poly.setPolynomial(c, 2, 12, 0);
+ *     int32_t mC = poly.apply(adcCounts);
+ */
+class FixedPolynomialMapper : public BaseFixedProcessor
+{
+public:
+    static constexpr uint8_t MAX_COEFFS = 8;
+
+private:
+    int32_t _q[MAX_COEFFS]; // Q31 normalised coefficients
+    uint8_t _degree;
+    uint8_t _inShift;       // 31 - INPUT_BITS: x → u in Q31
+    uint8_t _outShift;      // 31 - E - OUT_FRAC: Q31 · 2^E → Q(OUT_FRAC)
+
+public:
+    FixedPolynomialMapper() : _degree(1), _inShift(0), _outShift(0)
+    {
+        // Default pass through f(x) = x for 31-bit inputs
+        for (uint8_t i = 0; i < MAX_COEFFS; i++)
+        {
+            _q[i] = 0;
+        }
+
+        _q[1] = INT32_MAX;
+        setFixedType(FixedType::FIXED_POLYNOMIAL);
+    }
+
+    ~FixedPolynomialMapper() {}
+
+    /**
+     * Configure p(x) = Σ coeffs[k]·x^k for |x| < 2^inputBits with the result
+     * in Q(outFrac). Returns false if the degree or formats are out of range,
+     * if |p| can reach 2^(31 - outFrac) (no room in int32) or if |p| stays
+     * below 2^-outFrac (every output would round to 0).
+     */
+    bool setPolynomial(const float *coeffs, uint8_t degree, uint8_t inputBits, uint8_t outFrac)
+    {
+        if (degree >= MAX_COEFFS || inputBits > 31 || outFrac > 31)
+        {
+            return false;
+        }
+
+        // c'_k = c_k · FS^k for the normalised input, bounded by their sum
+        double scaled[MAX_COEFFS];
+        double bound = 0.0;
+        double fs = 1.0;
+
+        for (uint8_t k = 0; k <= degree; k++)
+        {
+            scaled[k] = coeffs[k] * fs;
+            bound += fabs(scaled[k]);
+            fs = ldexp(fs, inputBits);
+        }
+
+        // Smallest E with all partial sums < 2^E (tiny margin for rounding)
+        int e = 0;
+        bound *= 1.000001;
+
+        while (ldexp(1.0, e) <= bound && e < 62) { e++; }
+        while (e > -31 && ldexp(1.0, e - 1) > bound) { e--; }
+
+        int shift = 31 - e - outFrac;
+        if (shift < 0 || shift > 31)
+        {
+            return false;
+        }
+
+        for (uint8_t k = 0; k <= degree; k++)
+        {
+            _q[k] = FixedMath::fromDouble(ldexp(scaled[k], -e), 31);
+        }
+
+        _degree = degree;
+        _inShift = 31 - inputBits;
+        _outShift = static_cast<uint8_t>(shift);
+
+        return true;
+    }
+
+    int32_t apply(int32_t value) override
+    {
+        const int32_t u = value * (static_cast<int32_t>(1) << _inShift);
+        int32_t r = _q[_degree];
+
+        for (int i = _degree - 1; i >= 0; i--)
+        {
+            r = FixedMath::mulQ31(r, u) + _q[i];
+        }
+
+        return static_cast<int32_t>(FixedMath::roundShift64(r, _outShift));
+    }
+
+    uint8_t getDegree() const { return _degree; }
+};
+
+#endif // FIXED_POLYNOMIAL_MAPPER_H
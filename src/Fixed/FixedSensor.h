@@ -0,0 +1,160 @@
+#ifndef FIXED_SENSOR_H
+#define FIXED_SENSOR_H
+
+#include "BaseFixedProcessor.h"
+#include "SensorLock.h"
+#include "StageValueBuffer.h"
+
+/**
+ * Integer counterpart of BasicGenericSensor for targets without FPU: a chain
+ * of NUM_STAGES BaseFixedProcessor slots, int32_t in and out. Readers get
+ * the last published value lock-free, exactly like GenericSensor.
+ *
+ * Example usage (AVR, 10-bit ADC → m°C):
+ *     FixedEMAFilter ema(FixedMath::q15(0.2f));
+ *     FixedPiecewiseLinearTable<8> cal;
+ *     FixedSensor<2> sensor;
+ *     sensor.setProcessor(0, &ema);
+ *     sensor.setProcessor(1, &cal);
+ *     sensor.push(static_cast<int32_t>(analogRead(A0)));
+ *     int32_t mC = sensor.getReading();
+ */
+template <uint8_t NUM_STAGES, bool TRACK_STAGES = true>
+class FixedSensor
+{
+public:
+    static const uint8_t NUM_STAGE_VALUES = TRACK_STAGES ? NUM_STAGES + 1 : 1;
+
+    static_assert(NUM_STAGES > 0, "FixedSensor needs at least one processor slot");
+
+    typedef StageSnapshot<NUM_STAGE_VALUES, int32_t> StageValues;
+
+private:
+    static const uint8_t BLOCK_SIZE = 16; // Samples per pushBlock() chunk (stack scratch buffer)
+
+    SensorLock _lock;
+    StageValueBuffer<NUM_STAGE_VALUES, int32_t> processStageValue;
+
+public:
+    BaseFixedProcessor *processor[NUM_STAGES];
+
+    explicit FixedSensor(PushMode mode = PushMode::LOCKED) : _lock(mode)
+    {
+        for (uint8_t i = 0; i < NUM_STAGES; i++)
+        {
+            processor[i] = nullptr;
+        }
+    }
+
+    ~FixedSensor() {}
+
+    FixedSensor(const FixedSensor &) = delete;
+    FixedSensor &operator=(const FixedSensor &) = delete;
+
+    // Final processed value, lock-free
+    int32_t getReading() const { return processStageValue.read(NUM_STAGE_VALUES - 1); }
+
+    // Consistent copy of the input and every stage output from the same push
+    StageValues getProcessStagesValues() const { return processStageValue.snapshot(); }
+
+    PushMode getPushMode() const { return _lock.mode(); }
+
+    void push(int32_t value)
+    {
+        if (_lock.take())
+        {
+            int32_t *stage = processStageValue.beginWrite();
+
+            if (TRACK_STAGES)
+            {
+                stage[0] = value;
+            }
+
+            for (uint8_t i = 0; i < NUM_STAGES; i++)
+            {
+                if (processor[i])
+                {
+                    value = processor[i]->apply(value);
+                }
+
+                if (TRACK_STAGES)
+                {
+                    stage[i + 1] = value;
+                }
+            }
+
+            stage[NUM_STAGE_VALUES - 1] = value;
+            processStageValue.publish();
+
+            _lock.give();
+        }
+    }
+
+    // Block push: one lock per call, each stage runs over the block via
+    // applyBlock(). Stage values reflect the last sample of the block.
+    void pushBlock(const int32_t *samples, size_t n)
+    {
+        if (n == 0)
+        {
+            return;
+        }
+
+        if (_lock.take())
+        {
+            int32_t *stage = processStageValue.beginWrite();
+            int32_t block[BLOCK_SIZE];
+            bool emitted = false;
+
+            while (n > 0)
+            {
+                size_t count = (n < BLOCK_SIZE) ? n : BLOCK_SIZE;
+                const int32_t *src = samples;
+
+                samples += count;
+                n -= count;
+
+                if (TRACK_STAGES)
+                {
+                    stage[0] = src[count - 1];
+                }
+
+                for (uint8_t i = 0; i < NUM_STAGES; i++)
+                {
+                    if (processor[i] && count > 0)
+                    {
+                        count = processor[i]->applyBlock(src, block, count);
+                        src = block;
+                    }
+
+                    if (TRACK_STAGES && count > 0)
+                    {
+                        stage[i + 1] = src[count - 1];
+                    }
+                }
+
+                if (count > 0)
+                {
+                    stage[NUM_STAGE_VALUES - 1] = src[count - 1];
+                    emitted = true;
+                }
+            }
+
+            if (emitted)
+            {
+                processStageValue.publish();
+            }
+
+            _lock.give();
+        }
+    }
+
+    void setProcessor(uint8_t idx, BaseFixedProcessor *proc)
+    {
+        if (idx < NUM_STAGES)
+        {
+            processor[idx] = proc;
+        }
+    }
+};
+
+#endif // FIXED_SENSOR_H
@@ -2,76 +2,232 @@
 #define GENERIC_SENSOR_H
 
 #include "BaseMeasurementProcessor.h"
+#include "ProcessorPool.h"
+#include "SensorFeatures.h"
 #include "SensorInfo.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/semphr.h"
+#include "SensorLock.h"
+#include "StageValueBuffer.h"
 
-class GenericSensor
+#if defined(GENERIC_SENSOR_PROFILING)
+#include "PushProfile.h"
+#endif
+
+/**
+ * Processing pipeline of NUM_MAPPERS mapper slots followed by NUM_FILTERS
+ * filter slots. GenericSensor is the classic 3 + 2 layout; smaller sensors
+ * only pay for the slots they declare, e.g.
+ *
+ *     BasicGenericSensor<1, 0>        one mapper, one stage
+ *     BasicGenericSensor<1, 1, false> mapper + filter, final value only
+ *
+ * With TRACK_STAGES == false no intermediate stage values are stored:
+ * getProcessStagesValues() holds just the final value.
+ *
+ * setMapper()/setFilter() keep the classic mappers-then-filters layout;
+ * setProcessor() places any stage in any slot, e.g. a filter on raw ADC
+ * counts in front of the linearization. setDeferredFrom(idx) moves the
+ * tail of the chain to the reader side:
+ *
+ *     sensor.setProcessor(0, &ema);    // runs in push(), full sample rate
+ *     sensor.setProcessor(1, &rtd);    // runs in getReading(), read rate
+ *     sensor.setDeferredFrom(1);
+ *
+ * With an allocator (e.g. a static ProcessorPool) the sensor can own its
+ * processors: emplace<T>(idx, args...) constructs one into a pool block,
+ * replacing a slot or clearProcessors() returns owned ones to the pool,
+ * and so does the destructor. Never touches the heap.
+ *
+ * setHistory() attaches a SampleHistory ring that push() fills with
+ * (micros(), value) pairs of the in-push chain output, i.e. getReading()
+ * without the deferred stages; a logger drains it in batches with peek() /
+ * consume() instead of polling getReading() at the sample rate.
+ * setChangeDetector() does the same for report-by-exception publishers:
+ * the detector sees every output and flags only the ones worth sending.
+ *
+ * Stages may take side inputs from outside the chain, e.g. the cold-junction
+ * temperature of a ThermocoupleTypeK: setSideInput(), or push(value, inputs,
+ * count) to deliver them with the sample under one lock acquisition.
+ * SensorGraph wires the outputs of one sensor to the side inputs of others.
+ *
+ * Reconfiguration without stalling the producer: stagePipeline() validates
+ * a complete new processor set, built on the configuring task, and parks
+ * it; the producer swaps it in at the start of its next push() (one atomic
+ * load per push when nothing is staged, pointer copies when something is).
+ * carryState makes each new stage copyStateFrom() the one it replaces, so
+ * a filter change does not restart from the next raw sample. Replaced owned
+ * processors go back to the allocator in swapComplete(). Deferred slots
+ * run on reader tasks outside any lock and cannot be swapped this way;
+ * stagePipeline() refuses to change them (use setProcessor() while no
+ * reader runs).
+ *
+ *     RTD385 next(1000.0f);                     // Pt1000 now
+ *     BaseMeasurementProcessor *set[5] = {&next, nullptr, nullptr, &ema, nullptr};
+ *     if (sensor.stagePipeline(set, true)) { ... }
+ *     while (!sensor.swapComplete()) { vTaskDelay(1); }
+ *
+ * FEATURES (SensorFeature bits, SensorFeatures.h) selects which of these
+ * optional parts the sensor carries; GenericSensor has all of them. A
+ * sensor without SENSOR_OWNERSHIP has no allocator: setAllocator() fails
+ * and emplace() / adoptProcessor() return nullptr / false. Without
+ * SENSOR_HISTORY setHistory() is ignored, without SENSOR_CHANGE
+ * setChangeDetector(); without SENSOR_HOT_SWAP stagePipeline() fails (use
+ * setProcessor()).
+ *
+ * Defining GENERIC_SENSOR_PROFILING before the first include records cycle
+ * counts per slot, lock wait and total push latency (see getProfile()).
+ * Without it none of the timing code is compiled in.
+ */
+template <uint8_t NUM_MAPPERS, uint8_t NUM_FILTERS, bool TRACK_STAGES = true, uint8_t FEATURES = SENSOR_ALL_FEATURES>
+class BasicGenericSensor : private SensorOwnership<NUM_MAPPERS + NUM_FILTERS, (FEATURES & SENSOR_OWNERSHIP) != 0>,
+                           private SensorHistoryLink<(FEATURES & SENSOR_HISTORY) != 0>,
+                           private SensorChangeLink<(FEATURES & SENSOR_CHANGE) != 0>,
+                           private SensorSwapSlots<NUM_MAPPERS + NUM_FILTERS, (FEATURES & SENSOR_HOT_SWAP) != 0>
 {
+public:
+    static const uint8_t NUM_PROCESSORS = NUM_MAPPERS + NUM_FILTERS; // Total number of processors (mappers + filters)
+    static const uint8_t NUM_STAGE_VALUES = TRACK_STAGES ? NUM_PROCESSORS + 1 : 1;
+
+    static_assert(NUM_PROCESSORS > 0, "BasicGenericSensor needs at least one processor slot");
+
+    typedef StageSnapshot<NUM_STAGE_VALUES> StageValues;
+
+#if defined(GENERIC_SENSOR_PROFILING)
+    typedef PushProfile<NUM_PROCESSORS> Profile;
+#endif
+
 private:
-    mutable SemaphoreHandle_t _lock;
+    static const uint8_t BLOCK_SIZE = 32; // Samples per pushBlock() chunk (stack scratch buffer)
+
+    // Source of emplace()d processors and the slots it must get back
+    typedef SensorOwnership<NUM_PROCESSORS, (FEATURES & SENSOR_OWNERSHIP) != 0> Ownership;
+
+    // Optional record of every output; period stamps the outputs of one pushBlock()
+    typedef SensorHistoryLink<(FEATURES & SENSOR_HISTORY) != 0> History;
+
+    // Optional deadband / rate / heartbeat test on every output
+    typedef SensorChangeLink<(FEATURES & SENSOR_CHANGE) != 0> Change;
 
-    static const uint8_t NUM_PROCESSORS = 5; // Total number of processors (mappers + filters)
-    float processStageValue[NUM_PROCESSORS + 1];
+    // Staged pipeline: written by stagePipeline(), adopted by the producer
+    typedef SensorSwapSlots<NUM_PROCESSORS, (FEATURES & SENSOR_HOT_SWAP) != 0> Swap;
+
+    enum SwapState : uint8_t
+    {
+        SWAP_IDLE,    // nothing staged, slots empty
+        SWAP_WRITING, // a configuring task owns the slots
+        SWAP_STAGED,  // slots hold the complete set, waiting for the producer
+        SWAP_DONE     // adopted; slots hold the replaced owned processors
+    };
+
+    inline uint8_t swapState() const { return Swap::swapState(); }
+    inline void setSwapState(uint8_t state) { Swap::setSwapState(state); }
+    inline bool claimSwap(uint8_t expected) { return Swap::claimSwap(expected, SWAP_WRITING); }
+
+    // Guards processor state against concurrent producers (none in SINGLE_PRODUCER mode)
+    SensorLock _lock;
+
+    // Readers copy from here without ever taking _lock
+    StageValueBuffer<NUM_STAGE_VALUES> processStageValue;
+
+    // First slot evaluated in getReading() instead of push(); NUM_PROCESSORS = none
+    uint8_t _deferFrom;
+
+#if defined(GENERIC_SENSOR_PROFILING)
+    Profile _profile;
+#endif
 
 public:
     BaseMeasurementProcessor *processor[NUM_PROCESSORS];
-    
-    GenericSensor() : _lock(nullptr)
-    {
-        if (_lock == nullptr)
-        {
-            _lock = xSemaphoreCreateMutex();
-        }
 
+    // PushMode::SINGLE_PRODUCER skips the mutex entirely: only one task may
+    // call push()/pushBlock() and the setters. Readers never block in either mode.
+    explicit BasicGenericSensor(PushMode mode = PushMode::LOCKED) : _lock(mode), _deferFrom(NUM_PROCESSORS)
+    {
         // Initialize processor array to nullptr
         for (int i = 0; i < NUM_PROCESSORS; i++)
         {
             processor[i] = nullptr;
         }
+    }
 
-        // Initialize mappedValues array to 0.0f
-        for (int i = 0; i < NUM_PROCESSORS + 1; i++)
+    ~BasicGenericSensor()
+    {
+        // A set still waiting for the producer belongs to the caller
+        if (swapState() != SWAP_STAGED)
         {
-            processStageValue[i] = 0.0f;
+            destroyRetired();
         }
+
+        clearProcessors();
     }
 
-    ~GenericSensor()
+    BasicGenericSensor(const BasicGenericSensor &) = delete;
+    BasicGenericSensor &operator=(const BasicGenericSensor &) = delete;
+
+    // Get the final processed value (after all processors are applied).
+    // Lock-free; never blocks the producer. Deferred stages run here, on the
+    // caller's task.
+    float getReading() const
     {
-        if (_lock)
-        {
-            vSemaphoreDelete(_lock);
-        }
+        return applyDeferred(processStageValue.read(NUM_STAGE_VALUES - 1)); // Final processed value is at the last index
     }
 
-    // Get the final processed value (after all processors are applied)
-    float getReading()
+    // Consistent copy of the input and every stage output from the same push
+    // (deferred stage outputs are computed on the copy)
+    StageValues getProcessStagesValues() const
     {
-        float result = 0.0f;
+        StageValues values = processStageValue.snapshot();
 
-        if (xSemaphoreTake(_lock, portMAX_DELAY) == pdTRUE)
+        if (_deferFrom < NUM_PROCESSORS)
         {
-            result = processStageValue[NUM_PROCESSORS]; // Final processed value is at the last index
-            xSemaphoreGive(_lock);
+            float value = values.value[NUM_STAGE_VALUES - 1];
+
+            for (uint8_t i = _deferFrom; i < NUM_PROCESSORS; i++)
+            {
+                if (processor[i])
+                {
+                    value = processor[i]->apply(value);
+                }
+
+                if (TRACK_STAGES)
+                {
+                    values.value[i + 1] = value;
+                }
+            }
+
+            values.value[NUM_STAGE_VALUES - 1] = value;
         }
 
-        return result;
+        return values;
     }
 
-    float* getProcessStagesValues()
+    PushMode getPushMode() const { return _lock.mode(); }
+
+#if defined(GENERIC_SENSOR_PROFILING)
+    // Copy of the timing statistics, taken under the producer lock so it is
+    // consistent in LOCKED mode (in SINGLE_PRODUCER mode call from the producer)
+    Profile getProfile()
     {
-        float* stages = nullptr;
+        Profile copy;
 
-        if (xSemaphoreTake(_lock, portMAX_DELAY) == pdTRUE)
+        if (_lock.take())
         {
-            stages = processStageValue;
-            xSemaphoreGive(_lock);
+            copy = _profile;
+            _lock.give();
         }
 
-        return stages;
+        return copy;
     }
 
+    void resetProfile()
+    {
+        if (_lock.take())
+        {
+            _profile.reset();
+            _lock.give();
+        }
+    }
+#endif
+
     void push(uint32_t x)
     {
         float startValueFloat = static_cast<float>(x);
@@ -93,43 +249,650 @@ public:
     // Unified push method to process a new value
     void push(float startValue)
     {
-        if (xSemaphoreTake(_lock, portMAX_DELAY) == pdTRUE)
+        push(startValue, nullptr, 0);
+    }
+
+    // push() that first hands count side inputs to the in-push stages, under
+    // the same lock acquisition (see SensorGraph)
+    void push(float startValue, const SideInput *inputs, uint8_t count)
+    {
+#if defined(GENERIC_SENSOR_PROFILING)
+        const uint32_t tEnter = CycleCounter::now();
+#endif
+
+        if (_lock.take())
         {
+#if defined(GENERIC_SENSOR_PROFILING)
+            _profile.lockWait.record(CycleCounter::elapsed(tEnter));
+#endif
+
+            if (swapState() == SWAP_STAGED)
+            {
+                adoptStaged();
+            }
+
+            deliver(inputs, count);
+
+            float *stage = processStageValue.beginWrite();
+            float value = startValue;
+
             // Store the initial value at index 0 (before any processing)
-            processStageValue[0] = startValue;
+            if (TRACK_STAGES)
+            {
+                stage[0] = value;
+            }
+
+            // Apply all processors in sequence and store intermediate results.
+            // A decimating stage without output ends the pass: nothing downstream
+            // runs and the previous readings stay published.
+            bool emitted = true;
+
+            const uint8_t end = _deferFrom;
+
+            for (int i = 0; i < end; i++)
+            {
+                if (processor[i])
+                {
+#if defined(GENERIC_SENSOR_PROFILING)
+                    const uint32_t t0 = CycleCounter::now();
+                    value = processor[i]->apply(value);
+                    _profile.stage[i].record(CycleCounter::elapsed(t0));
+#else
+                    value = processor[i]->apply(value);
+#endif
+
+                    if (!processor[i]->outputReady())
+                    {
+                        emitted = false;
+                        break;
+                    }
+                }
+
+                if (TRACK_STAGES)
+                {
+                    stage[i + 1] = value;
+                }
+            }
+
+            if (emitted)
+            {
+                stage[NUM_STAGE_VALUES - 1] = value;
+                processStageValue.publish();
+
+                if (SampleHistory *history = History::history())
+                {
+                    history->append(micros(), value);
+                }
+
+                if (ChangeDetector *change = Change::detector())
+                {
+                    change->update(value, millis());
+                }
+            }
+
+#if defined(GENERIC_SENSOR_PROFILING)
+            _profile.total.record(CycleCounter::elapsed(tEnter));
+#endif
+
+            _lock.give();
+        }
+    }
+
+    // Block push for DMA-style acquisition: the lock is taken once per call and
+    // each processor runs over the whole block via applyBlock().
+    // Stage values reflect the last sample that reached each stage; with a
+    // decimating stage the readings are only published if a sample made it
+    // through the whole chain.
+    void pushBlock(const float *samples, size_t n)
+    {
+        if (n == 0)
+        {
+            return;
+        }
+
+#if defined(GENERIC_SENSOR_PROFILING)
+        const uint32_t tEnter = CycleCounter::now();
+        const size_t total = n;
+#endif
+
+        if (_lock.take())
+        {
+#if defined(GENERIC_SENSOR_PROFILING)
+            _profile.lockWait.record(CycleCounter::elapsed(tEnter));
+#endif
+
+            if (swapState() == SWAP_STAGED)
+            {
+                adoptStaged();
+            }
+
+            float *stage = processStageValue.beginWrite();
+            float block[BLOCK_SIZE];
+            bool emitted = false;
+            const uint8_t end = _deferFrom;
+            SampleHistory *const history = History::history();
+
+            while (n > 0)
+            {
+                size_t count = (n < BLOCK_SIZE) ? n : BLOCK_SIZE;
+                const float *src = samples;
+
+                samples += count;
+                n -= count;
+
+                if (TRACK_STAGES)
+                {
+                    stage[0] = src[count - 1];
+                }
+
+                for (int i = 0; i < end; i++)
+                {
+                    if (processor[i] && count > 0)
+                    {
+#if defined(GENERIC_SENSOR_PROFILING)
+                        const uint32_t t0 = CycleCounter::now();
+                        const size_t in = count;
+                        count = processor[i]->applyBlock(src, block, count);
+                        _profile.stage[i].record(CycleCounter::elapsed(t0) / in);
+#else
+                        count = processor[i]->applyBlock(src, block, count);
+#endif
+                        src = block;
+                    }
+
+                    if (TRACK_STAGES && count > 0)
+                    {
+                        stage[i + 1] = src[count - 1];
+                    }
+                }
+
+                if (count > 0)
+                {
+                    stage[NUM_STAGE_VALUES - 1] = src[count - 1];
+                    emitted = true;
+
+                    if (history)
+                    {
+                        for (size_t k = 0; k < count; k++)
+                        {
+                            history->stage(src[k]);
+                        }
+                    }
+                }
+            }
 
-            // Apply all processors in sequence and store intermediate results in mappedValues
-            for (int i = 0; i < NUM_PROCESSORS; i++)
+            if (emitted)
             {
-                processStageValue[i + 1] = (processor[i]) ? processor[i]->apply(processStageValue[i]) : processStageValue[i];
+                processStageValue.publish();
+
+                if (history)
+                {
+                    history->commit(micros(), History::periodUs());
+                }
+
+                if (ChangeDetector *change = Change::detector())
+                {
+                    change->update(stage[NUM_STAGE_VALUES - 1], millis());
+                }
             }
 
-            xSemaphoreGive(_lock);
+#if defined(GENERIC_SENSOR_PROFILING)
+            _profile.total.record(CycleCounter::elapsed(tEnter) / total);
+#endif
+
+            _lock.give();
         }
     }
 
-    // Setters for mappers and filters with clear validation
+    // Setters for mappers and filters with clear validation.
+    // proc stays caller-owned; an owned processor in the slot goes back to the allocator.
     void setMapper(uint8_t idx, BaseMeasurementProcessor *proc)
     {
-        if (idx < 3) // Mappers are indices 0, 1, 2
+        if (idx < NUM_MAPPERS) // Mappers are indices 0 .. NUM_MAPPERS - 1
         {
-            processor[idx] = proc;
+            install(idx, proc, false);
         }
     }
 
     void setFilter(uint8_t idx, BaseMeasurementProcessor *proc)
     {
-        if (idx < 2) // Filters are indices 3 and 4
+        if (idx < NUM_FILTERS) // Filters follow the mapper slots
         {
-            processor[idx + 3] = proc; // Offset the filter indices by 3
+            install(idx + NUM_MAPPERS, proc, false); // Offset the filter indices by NUM_MAPPERS
         }
     }
 
-private:
+    // Any processor in any slot, independent of the mapper/filter split
     void setProcessor(uint8_t idx, BaseMeasurementProcessor *proc)
     {
-        processor[idx] = proc;
+        if (idx < NUM_PROCESSORS)
+        {
+            install(idx, proc, false);
+        }
+    }
+
+    /**
+     * Allocator for emplace() / adoptProcessor(). Can only change while the
+     * sensor owns no processors (returns false otherwise), so every owned
+     * processor goes back to the allocator it came from. Always false for a
+     * non-null allocator without SENSOR_OWNERSHIP.
+     */
+    bool setAllocator(ProcessorAllocator *allocator)
+    {
+        for (uint8_t i = 0; i < NUM_PROCESSORS; i++)
+        {
+            if (Ownership::owned(i) || (swapState() == SWAP_DONE && Swap::slot(i)))
+            {
+                return false;
+            }
+        }
+
+        Ownership::setAllocator(allocator);
+        return Ownership::allocator() == allocator;
+    }
+
+    ProcessorAllocator *getAllocator() const { return Ownership::allocator(); }
+
+    // Construct a T from the allocator into slot idx, owned by the sensor.
+    // Returns nullptr (slot unchanged) without allocator or free block.
+    template <class T, class... Args>
+    T *emplace(uint8_t idx, Args &&...args)
+    {
+        ProcessorAllocator *const allocator = Ownership::allocator();
+
+        if (idx >= NUM_PROCESSORS || allocator == nullptr)
+        {
+            return nullptr;
+        }
+
+        T *proc = allocator->template create<T>(static_cast<Args &&>(args)...);
+
+        if (proc && !install(idx, proc, true))
+        {
+            proc = nullptr;
+        }
+
+        return proc;
+    }
+
+    // Take ownership of a processor created from getAllocator() (e.g. by ProcessorFactory)
+    bool adoptProcessor(uint8_t idx, BaseMeasurementProcessor *proc)
+    {
+        return idx < NUM_PROCESSORS && Ownership::allocator() != nullptr && install(idx, proc, proc != nullptr);
+    }
+
+    bool isOwned(uint8_t idx) const { return idx < NUM_PROCESSORS && Ownership::owned(idx); }
+
+    // Empty every slot; owned processors are destroyed and returned to the allocator
+    void clearProcessors()
+    {
+        for (uint8_t i = 0; i < NUM_PROCESSORS; i++)
+        {
+            install(i, nullptr, false);
+        }
+    }
+
+    /**
+     * Stage a complete processor set (procs[i] for slot i, nullptr = empty)
+     * for the producer to adopt at its next push() / pushBlock(). Every
+     * processor must pass validate() first; false (nothing staged) if one
+     * does not, if a previous set is still staged, or if a deferred slot
+     * (setDeferredFrom()) would change: readers may be inside those stages
+     * at any time, so they can be neither replaced nor destroyed here.
+     * Staged processors are not owned by the sensor; owned ones they
+     * replace are destroyed by swapComplete(). With carryState each new processor copies the filter
+     * state of the one in its slot (copyStateFrom(); a type mismatch leaves
+     * it fresh). Staged processors must stay untouched until adopted.
+     */
+    bool stagePipeline(BaseMeasurementProcessor *const procs[NUM_PROCESSORS], bool carryState = false)
+    {
+        if (!claimSwap(SWAP_IDLE))
+        {
+            if (!claimSwap(SWAP_DONE))
+            {
+                return false;
+            }
+
+            destroyRetired();
+        }
+
+        for (uint8_t i = 0; i < NUM_PROCESSORS; i++)
+        {
+            if ((procs[i] && !procs[i]->validate()) || (i >= _deferFrom && procs[i] != processor[i]))
+            {
+                setSwapState(SWAP_IDLE);
+                return false;
+            }
+        }
+
+        for (uint8_t i = 0; i < NUM_PROCESSORS; i++)
+        {
+            Swap::setSlot(i, procs[i]);
+        }
+
+        Swap::setCarry(carryState);
+        setSwapState(SWAP_STAGED);
+        return true;
+    }
+
+    // True once the staged set is live (or nothing was staged); returns the
+    // processors it replaced to the allocator. Call from the configuring task.
+    bool swapComplete()
+    {
+        if (claimSwap(SWAP_DONE))
+        {
+            destroyRetired();
+            setSwapState(SWAP_IDLE);
+        }
+
+        return swapState() == SWAP_IDLE;
+    }
+
+    // Adopt the staged set now instead of at the next push (e.g. a sensor
+    // that is not sampled at the moment); takes the producer lock once
+    bool commitStaged()
+    {
+        if (_lock.take())
+        {
+            if (swapState() == SWAP_STAGED)
+            {
+                adoptStaged();
+            }
+
+            _lock.give();
+        }
+
+        return swapComplete();
+    }
+
+    bool isSwapPending() const { return swapState() == SWAP_STAGED; }
+
+    /**
+     * Evaluate slots idx … NUM_PROCESSORS - 1 lazily in getReading() instead
+     * of in push(); NUM_PROCESSORS (the default) defers nothing. The last
+     * stage value then holds the output of slot idx - 1, i.e. the input of
+     * the deferred stages.
+     *
+     * Deferred stages run on every reader's task, possibly several at once,
+     * so they must be pure mappers whose apply() writes no state (no
+     * filters, no decimators). The shipped mappers qualify, the tables
+     * included: their segment hint is a relaxed atomic. Configure before
+     * pushing starts.
+     */
+    void setDeferredFrom(uint8_t idx)
+    {
+        if (_lock.take())
+        {
+            _deferFrom = (idx < NUM_PROCESSORS) ? idx : NUM_PROCESSORS;
+            _lock.give();
+        }
+    }
+
+    uint8_t getDeferredFrom() const { return _deferFrom; }
+
+    // Side input for the in-push stages that take it (e.g. ThermocoupleTypeK
+    // cold junction); false if none does
+    bool setSideInput(uint8_t channel, float value)
+    {
+        bool taken = false;
+
+        if (_lock.take())
+        {
+            const SideInput input = {channel, value};
+            taken = deliver(&input, 1);
+            _lock.give();
+        }
+
+        return taken;
+    }
+
+    /**
+     * Fuse adjacent stages to save stage hops and roundings: an affine stage
+     * (e.g. PolynomialMapper::setLinear() for ADC counts → Ω) is folded into
+     * the input of the next stage (RTD385 normalization, table breakpoints,
+     * polynomial coefficients) or else into the output of the previous one,
+     * and its slot is emptied. Only stages on the same side of
+     * setDeferredFrom() are fused. getReading() is unchanged up to float
+     * rounding; removed slots no longer report an intermediate stage value.
+     * The surviving processors are rewritten, so they must not be shared
+     * with other sensors. Returns the number of slots removed.
+     */
+    uint8_t optimize()
+    {
+        BaseMeasurementProcessor *released[NUM_PROCESSORS];
+        uint8_t removed = 0;
+        uint8_t numReleased = 0;
+
+        if (!_lock.take())
+        {
+            return 0;
+        }
+
+        const uint8_t bounds[3] = {0, _deferFrom, NUM_PROCESSORS};
+
+        for (uint8_t part = 0; part < 2; part++)
+        {
+            bool fused = true;
+
+            while (fused)
+            {
+                fused = false;
+
+                for (uint8_t i = bounds[part]; i < bounds[part + 1] && !fused; i++)
+                {
+                    uint8_t j = i + 1;
+
+                    while (j < bounds[part + 1] && processor[j] == nullptr)
+                    {
+                        j++;
+                    }
+
+                    if (processor[i] == nullptr || j >= bounds[part + 1])
+                    {
+                        continue;
+                    }
+
+                    float m, b;
+                    uint8_t drop = NUM_PROCESSORS;
+
+                    if (processor[i]->getAffine(m, b) && processor[j]->foldInputAffine(m, b))
+                    {
+                        drop = i;
+                    }
+                    else if (processor[j]->getAffine(m, b) && processor[i]->foldOutputAffine(m, b))
+                    {
+                        drop = j;
+                    }
+
+                    if (drop < NUM_PROCESSORS)
+                    {
+                        if (Ownership::owned(drop))
+                        {
+                            released[numReleased++] = processor[drop];
+                        }
+
+                        processor[drop] = nullptr;
+                        Ownership::setOwned(drop, false);
+                        removed++;
+                        fused = true;
+                    }
+                }
+            }
+        }
+
+        _lock.give();
+
+        // Owned stages go back to the allocator once push() cannot be inside them
+        for (uint8_t k = 0; k < numReleased; k++)
+        {
+            Ownership::destroy(released[k]);
+        }
+
+        return removed;
+    }
+
+    /**
+     * Record every output into history (nullptr detaches). Outputs of one
+     * pushBlock() are stamped backwards from the call time in steps of
+     * outputPeriodUs, the sample period after any decimation (0: all get the
+     * call time). Ignored without SENSOR_HISTORY.
+     */
+    void setHistory(SampleHistory *history, uint32_t outputPeriodUs = 0)
+    {
+        if (_lock.take())
+        {
+            History::attach(history, outputPeriodUs);
+            _lock.give();
+        }
+    }
+
+    SampleHistory *getHistory() const { return History::history(); }
+
+    // Test every output against detector (nullptr detaches); pushBlock()
+    // tests the last output of the block. Ignored without SENSOR_CHANGE.
+    void setChangeDetector(ChangeDetector *detector)
+    {
+        if (_lock.take())
+        {
+            Change::attach(detector);
+            _lock.give();
+        }
+    }
+
+    ChangeDetector *getChangeDetector() const { return Change::detector(); }
+
+    // Output variance from the last in-push stage that tracks one (normally a
+    // Kalman filter behind the mapper); false if none does. Read without the
+    // lock, so call from the producer for a value matching getReading().
+    bool getErrorVariance(float &variance) const
+    {
+        for (int i = _deferFrom - 1; i >= 0; i--)
+        {
+            if (processor[i] && processor[i]->getErrorVariance(variance))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    /**
+     * Swap proc into slot idx under the producer lock, then destroy the
+     * previous processor if the sensor owned it: push() cannot be inside it
+     * any more. Deferred slots also run on reader tasks; replace those only
+     * while no reader is active. An owned proc that could not be installed
+     * is destroyed.
+     */
+    bool install(uint8_t idx, BaseMeasurementProcessor *proc, bool owned)
+    {
+        BaseMeasurementProcessor *previous = nullptr;
+        bool installed = false;
+
+        if (_lock.take())
+        {
+            if (Ownership::owned(idx) && processor[idx] != proc)
+            {
+                previous = processor[idx];
+            }
+
+            processor[idx] = proc;
+            Ownership::setOwned(idx, owned && proc != nullptr);
+            installed = true;
+
+            _lock.give();
+        }
+
+        if (previous)
+        {
+            Ownership::destroy(previous);
+        }
+
+        if (!installed && owned && proc)
+        {
+            Ownership::destroy(proc);
+        }
+
+        return installed;
+    }
+
+    // Producer side, under _lock: pointer copies only, replaced owned
+    // processors are parked in the swap slots for swapComplete()
+    void adoptStaged()
+    {
+        // Deferred slots stay (stagePipeline() rejects changes to them)
+        for (uint8_t i = 0; i < NUM_PROCESSORS; i++)
+        {
+            BaseMeasurementProcessor *const old = processor[i];
+            BaseMeasurementProcessor *const neu = Swap::slot(i);
+            BaseMeasurementProcessor *retired = nullptr;
+
+            if (i < _deferFrom && old != neu)
+            {
+                if (Swap::carry() && old && neu)
+                {
+                    neu->copyStateFrom(*old);
+                }
+
+                retired = Ownership::owned(i) ? old : nullptr;
+                Ownership::setOwned(i, false);
+                processor[i] = neu;
+            }
+
+            Swap::setSlot(i, retired);
+        }
+
+        setSwapState(SWAP_DONE);
+    }
+
+    // Caller holds SWAP_WRITING (or is the destructor, with nothing staged)
+    void destroyRetired()
+    {
+        for (uint8_t i = 0; i < NUM_PROCESSORS; i++)
+        {
+            if (BaseMeasurementProcessor *const retired = Swap::slot(i))
+            {
+                Ownership::destroy(retired);
+                Swap::setSlot(i, nullptr);
+            }
+        }
+    }
+
+    // Under _lock; deferred stages run on readers and get no side inputs
+    bool deliver(const SideInput *inputs, uint8_t count)
+    {
+        bool taken = false;
+
+        for (uint8_t k = 0; k < count; k++)
+        {
+            for (uint8_t i = 0; i < _deferFrom; i++)
+            {
+                if (processor[i] && processor[i]->setSideInput(inputs[k].channel, inputs[k].value))
+                {
+                    taken = true;
+                }
+            }
+        }
+
+        return taken;
+    }
+
+    inline float applyDeferred(float value) const
+    {
+        for (uint8_t i = _deferFrom; i < NUM_PROCESSORS; i++)
+        {
+            if (processor[i])
+            {
+                value = processor[i]->apply(value);
+            }
+        }
+
+        return value;
     }
 };
 
+// Classic layout: 3 mapper slots followed by 2 filter slots, all stages tracked
+typedef BasicGenericSensor<3, 2> GenericSensor;
+
 #endif // GENERIC_SENSOR_H
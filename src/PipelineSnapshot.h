@@ -0,0 +1,308 @@
+#ifndef PIPELINE_SNAPSHOT_H
+#define PIPELINE_SNAPSHOT_H
+
+#include "BaseMeasurementProcessor.h"
+
+/**
+ * Versioned binary images of processor configurations, for NVS / EEPROM /
+ * flash: one processor, an array of slots, or a whole sensor pipeline.
+ *
+ * Layout (native byte order and float format: restore on the same target):
+ *     header   'G' 'S' VERSION count deferFrom 0 payloadLength(uint16)
+ *     count ×  extraLength(uint16), 0xFFFF = empty slot
+ *              ProcessorConfig (80 bytes)        unless empty
+ *              extra[extraLength]                 saveExtra() data
+ *     crc32    over header and payload
+ *
+ * Extra data carries everything outside cfg, including derived caches
+ * (table slopes and spline segments, biquad coefficients), so restoring
+ * re-runs no sort, fit or table sampling. Images concatenate: save*()
+ * returns the bytes written and restore*() the bytes consumed, so a rack of
+ * sensors goes into one blob and comes back from one read.
+ *
+ * restore*() loads into existing processors of the same types (tags are
+ * checked); ProcessorFactory::buildSensor() reconstructs the processors
+ * from the tags instead. Neither is synchronised with push().
+ *
+ * Example usage (ESP32 Preferences):
+ *     uint8_t buf[512];
+ *     size_t n = PipelineSnapshot::saveSensor(sensor, buf, sizeof(buf));
+ *     prefs.putBytes("pipe", buf, n);
+ *     ...
+ *     size_t len = prefs.getBytes("pipe", buf, sizeof(buf));
+ *     if (!PipelineSnapshot::restoreSensor(sensor, buf, len)) { configureDefaults(); }
+ */
+class PipelineSnapshot
+{
+public:
+    static constexpr uint8_t VERSION = 2; // 2: RTD385 folded input stage in cfg.f[12..13]
+    static constexpr size_t HEADER_SIZE = 8;
+    static constexpr size_t RECORD_HEADER_SIZE = 2;
+    static constexpr size_t CONFIG_SIZE = sizeof(ProcessorConfig);
+    static constexpr size_t CRC_SIZE = 4;
+    static constexpr uint16_t EMPTY_SLOT = 0xFFFF;
+
+    // One decoded slot of an image
+    struct Record
+    {
+        bool empty;
+        ProcessorConfig config;
+        const uint8_t *extra;
+        uint16_t extraLength;
+    };
+
+    // CRC-32 (IEEE 802.3, reflected), bitwise: no table in flash
+    static uint32_t crc32(const uint8_t *data, size_t n, uint32_t crc = 0)
+    {
+        crc = ~crc;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            crc ^= data[i];
+
+            for (uint8_t b = 0; b < 8; b++)
+            {
+                crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+            }
+        }
+
+        return ~crc;
+    }
+
+    // Bytes save() needs for count slots (nullptr slots included)
+    static size_t requiredSize(BaseMeasurementProcessor *const *procs, uint8_t count)
+    {
+        size_t bytes = HEADER_SIZE + CRC_SIZE;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            bytes += RECORD_HEADER_SIZE;
+
+            if (procs[i])
+            {
+                bytes += CONFIG_SIZE + procs[i]->saveExtra(nullptr);
+            }
+        }
+
+        return bytes;
+    }
+
+    // Image of count slots into buf; returns its length, 0 if cap is too small
+    static size_t save(BaseMeasurementProcessor *const *procs, uint8_t count, uint8_t deferFrom, uint8_t *buf, size_t cap)
+    {
+        const size_t total = requiredSize(procs, count);
+
+        if (buf == nullptr || total > cap || total - HEADER_SIZE - CRC_SIZE > 0xFFFF)
+        {
+            return 0;
+        }
+
+        const uint16_t payload = static_cast<uint16_t>(total - HEADER_SIZE - CRC_SIZE);
+
+        buf[0] = 'G';
+        buf[1] = 'S';
+        buf[2] = VERSION;
+        buf[3] = count;
+        buf[4] = deferFrom;
+        buf[5] = 0;
+        memcpy(buf + 6, &payload, sizeof(payload));
+
+        uint8_t *p = buf + HEADER_SIZE;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (!procs[i])
+            {
+                const uint16_t empty = EMPTY_SLOT;
+                memcpy(p, &empty, sizeof(empty));
+                p += RECORD_HEADER_SIZE;
+                continue;
+            }
+
+            const uint16_t extra = procs[i]->saveExtra(nullptr);
+
+            memcpy(p, &extra, sizeof(extra));
+            memcpy(p + RECORD_HEADER_SIZE, &procs[i]->getConfig(), CONFIG_SIZE);
+            procs[i]->saveExtra(p + RECORD_HEADER_SIZE + CONFIG_SIZE);
+
+            p += RECORD_HEADER_SIZE + CONFIG_SIZE + extra;
+        }
+
+        const uint32_t crc = crc32(buf, p - buf);
+        memcpy(p, &crc, sizeof(crc));
+
+        return total;
+    }
+
+    // Image length if buf starts with a complete, intact image, else 0
+    static size_t check(const uint8_t *buf, size_t len, uint8_t *count = nullptr, uint8_t *deferFrom = nullptr)
+    {
+        if (buf == nullptr || len < HEADER_SIZE + CRC_SIZE || buf[0] != 'G' || buf[1] != 'S' || buf[2] != VERSION)
+        {
+            return 0;
+        }
+
+        uint16_t payload;
+        memcpy(&payload, buf + 6, sizeof(payload));
+
+        const size_t total = HEADER_SIZE + payload + CRC_SIZE;
+        uint32_t crc;
+
+        if (total > len)
+        {
+            return 0;
+        }
+
+        memcpy(&crc, buf + HEADER_SIZE + payload, sizeof(crc));
+
+        if (crc != crc32(buf, HEADER_SIZE + payload))
+        {
+            return 0;
+        }
+
+        if (count) { *count = buf[3]; }
+        if (deferFrom) { *deferFrom = buf[4]; }
+
+        return total;
+    }
+
+    // Decode the slot at p of a checked image and advance p; false if it overruns end
+    static bool readRecord(const uint8_t *&p, const uint8_t *end, Record &record)
+    {
+        uint16_t extra;
+
+        if (end - p < static_cast<ptrdiff_t>(RECORD_HEADER_SIZE))
+        {
+            return false;
+        }
+
+        memcpy(&extra, p, sizeof(extra));
+        p += RECORD_HEADER_SIZE;
+
+        record.empty = (extra == EMPTY_SLOT);
+        record.extra = nullptr;
+        record.extraLength = 0;
+
+        if (record.empty)
+        {
+            return true;
+        }
+
+        if (end - p < static_cast<ptrdiff_t>(CONFIG_SIZE + extra))
+        {
+            return false;
+        }
+
+        memcpy(&record.config, p, CONFIG_SIZE);
+        record.extra = p + CONFIG_SIZE;
+        record.extraLength = extra;
+        p += CONFIG_SIZE + extra;
+
+        return true;
+    }
+
+    // First slot and end of the payload of a checked image
+    static const uint8_t *payloadBegin(const uint8_t *buf) { return buf + HEADER_SIZE; }
+
+    static const uint8_t *payloadEnd(const uint8_t *buf)
+    {
+        uint16_t payload;
+        memcpy(&payload, buf + 6, sizeof(payload));
+        return buf + HEADER_SIZE + payload;
+    }
+
+    /**
+     * Load an image into count existing slots. The slot layout must match:
+     * same count, nullptr where the image has empty slots, same processor
+     * types elsewhere, extra data that fits each processor (canLoadConfig():
+     * lengths, table capacity, ranges). Checked for all slots before
+     * anything is loaded, so a rejected image leaves every slot unchanged.
+     * Returns the bytes consumed, 0 on any mismatch.
+     */
+    static size_t restore(BaseMeasurementProcessor *const *procs, uint8_t count, const uint8_t *buf, size_t len, uint8_t *deferFrom = nullptr)
+    {
+        uint8_t n = 0;
+        const size_t total = check(buf, len, &n, deferFrom);
+
+        if (total == 0 || n != count)
+        {
+            return 0;
+        }
+
+        const uint8_t *end = payloadEnd(buf);
+        const uint8_t *p = payloadBegin(buf);
+        Record record;
+
+        // Pass 1: layout, types and extra data, nothing changed yet
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (!readRecord(p, end, record) || record.empty != (procs[i] == nullptr) ||
+                (procs[i] && !procs[i]->canLoadConfig(record.config, record.extra, record.extraLength)))
+            {
+                return 0;
+            }
+        }
+
+        if (p != end)
+        {
+            return 0;
+        }
+
+        // Pass 2: load
+        p = payloadBegin(buf);
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            readRecord(p, end, record);
+
+            if (procs[i] && !procs[i]->loadConfig(record.config, record.extra, record.extraLength))
+            {
+                return 0;
+            }
+        }
+
+        return total;
+    }
+
+    static size_t saveProcessor(BaseMeasurementProcessor &proc, uint8_t *buf, size_t cap)
+    {
+        BaseMeasurementProcessor *slot = &proc;
+        return save(&slot, 1, 1, buf, cap);
+    }
+
+    static size_t restoreProcessor(BaseMeasurementProcessor &proc, const uint8_t *buf, size_t len)
+    {
+        BaseMeasurementProcessor *slot = &proc;
+        return restore(&slot, 1, buf, len);
+    }
+
+    // Whole pipeline of a BasicGenericSensor, including setDeferredFrom()
+    template <class Sensor>
+    static size_t saveSensor(const Sensor &sensor, uint8_t *buf, size_t cap)
+    {
+        return save(sensor.processor, Sensor::NUM_PROCESSORS, sensor.getDeferredFrom(), buf, cap);
+    }
+
+    template <class Sensor>
+    static size_t restoreSensor(Sensor &sensor, const uint8_t *buf, size_t len)
+    {
+        uint8_t deferFrom = Sensor::NUM_PROCESSORS;
+        const size_t used = restore(sensor.processor, Sensor::NUM_PROCESSORS, buf, len, &deferFrom);
+
+        if (used)
+        {
+            sensor.setDeferredFrom(deferFrom);
+        }
+
+        return used;
+    }
+
+    static bool sameType(const ProcessorConfig &a, const ProcessorConfig &b)
+    {
+        return a.u[BaseMeasurementProcessor::POS_PROCESSOR_TYPE] == b.u[BaseMeasurementProcessor::POS_PROCESSOR_TYPE] &&
+               a.u[BaseMeasurementProcessor::POS_MAPPER_TYPE] == b.u[BaseMeasurementProcessor::POS_MAPPER_TYPE] &&
+               a.u[BaseMeasurementProcessor::POS_SUB_TYPE] == b.u[BaseMeasurementProcessor::POS_SUB_TYPE];
+    }
+};
+
+#endif // PIPELINE_SNAPSHOT_H
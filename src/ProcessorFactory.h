@@ -0,0 +1,329 @@
+#ifndef PROCESSOR_FACTORY_H
+#define PROCESSOR_FACTORY_H
+
+#if defined(__AVR__)
+#include <new.h>
+#else
+#include <new>
+#endif
+
+#include "PipelineSnapshot.h"
+#include "ProcessorPool.h"
+#include "PolynomialMapper.h"
+#include "RTD_385.h"
+#include "NTCSteinhartHart.h"
+#include "ThermocoupleTypeK.h"
+#include "PiecewiseLinearTable.h"
+#include "CubicSplineTable.h"
+#include "CubicHermiteMonotonicSplineTable.h"
+#include "EMAFilter.h"
+#include "AdaptiveAbsoluteEMAFilter.h"
+#include "AlphaBetaFilter.h"
+#include "KalmanFilter.h"
+#include "KalmanCVFilter.h"
+#include "Median3Filter.h"
+#include "CICDecimatorFilter.h"
+
+// Largest sizeof() of a type list, for ProcessorSlot
+template <typename T, typename... Rest>
+struct MaxSizeOf
+{
+    static constexpr size_t value = (sizeof(T) > MaxSizeOf<Rest...>::value) ? sizeof(T) : MaxSizeOf<Rest...>::value;
+};
+
+template <typename T>
+struct MaxSizeOf<T>
+{
+    static constexpr size_t value = sizeof(T);
+};
+
+// Storage for one ProcessorFactory::create()d processor (8-byte aligned for the CIC integrators)
+struct ProcessorSlot
+{
+    static constexpr size_t SIZE = MaxSizeOf<PolynomialMapper, RTD385, RTD385Segmented, NTCSteinhartHart, ThermocoupleTypeK,
+                                             PiecewiseLinearTable, CubicSplineTable, CubicHermiteMonotonicSplineTable,
+                                             EMAFilter, AdaptiveAbsoluteEMAFilter, AlphaBetaFilter, KalmanFilter,
+                                             KalmanCVFilter, Median3Filter, CICDecimatorFilter>::value;
+
+    alignas(8) uint8_t bytes[SIZE];
+};
+
+/**
+ * Reconstructs processors from the type tags of a ProcessorConfig, by
+ * placement new into caller-provided ProcessorSlot storage (no heap).
+ *
+ * Covers every non-template processor with its configuration in cfg and
+ * extra data: PolynomialMapper (also the fixed RTD385_* polynomials),
+ * RTD385, RTD385Segmented, NTCSteinhartHart, ThermocoupleTypeK, the three
+ * point tables (up to 8 points, i.e. in cfg), EMA, adaptive EMA,
+ * alpha-beta, both Kalman filters, Median3 and CIC.
+ * Templates (SMA, median/min-max windows, biquad, half-band) and tables in
+ * caller storage need their concrete instance: restore those in place with
+ * PipelineSnapshot::restore*().
+ *
+ * Example usage (64 channels restored from one EEPROM read):
+ *     static GenericSensor sensors[64];
+ *     static ProcessorSlot slots[64][GenericSensor::NUM_PROCESSORS];
+ *     size_t off = 0;
+ *     for (uint8_t ch = 0; ch < 64; ch++) { off += ProcessorFactory::buildSensor(sensors[ch], blob + off, len - off, slots[ch]); }
+ *
+ * or, with sensor-owned processors from a shared pool (see ProcessorPool.h):
+ *     static ProcessorPool<128, ProcessorSlot::SIZE> pool;
+ *     sensors[ch].setAllocator(&pool);
+ *     off += ProcessorFactory::buildSensor(sensors[ch], blob + off, len - off);
+ */
+class ProcessorFactory
+{
+public:
+    static constexpr size_t SLOT_SIZE = ProcessorSlot::SIZE;
+
+    // sizeof() of the processor tagged in config, 0 if unsupported
+    static size_t sizeFor(const ProcessorConfig &config)
+    {
+        size_t needed = 0;
+        construct(config, nullptr, 0, &needed);
+        return needed;
+    }
+
+    /**
+     * Construct the processor tagged in config into mem and load config and
+     * extra into it. Returns nullptr for unsupported types, if mem is
+     * smaller than sizeFor(config) or if the data does not fit the type.
+     */
+    static BaseMeasurementProcessor *create(const ProcessorConfig &config, void *mem, size_t size,
+                                            const uint8_t *extra = nullptr, uint16_t extraLength = 0)
+    {
+        if (mem == nullptr)
+        {
+            return nullptr;
+        }
+
+        BaseMeasurementProcessor *p = construct(config, mem, size, nullptr);
+
+        if (p && !p->loadConfig(config, extra, extraLength))
+        {
+            destroy(p);
+            p = nullptr;
+        }
+
+        return p;
+    }
+
+    // Ends the lifetime of a create()d processor before its slot is reused
+    static void destroy(BaseMeasurementProcessor *p)
+    {
+        if (p)
+        {
+            p->~BaseMeasurementProcessor();
+        }
+    }
+
+    /**
+     * Rebuild every slot of a sensor from a PipelineSnapshot image into
+     * slots[Sensor::NUM_PROCESSORS], installed with setProcessor(): owned
+     * processors the sensor held go back to its allocator, caller-owned
+     * ones are left alone (the caller destroys them once unused).
+     * Returns the bytes consumed, 0 if the image is invalid, holds an
+     * unsupported type or if the sensor still points into slots (sensor
+     * unchanged). To reconfigure a live sensor, build into a second slot
+     * array and alternate: construction never touches a live processor and
+     * each slot changes under the producer lock.
+     */
+    template <class Sensor>
+    static size_t buildSensor(Sensor &sensor, const uint8_t *buf, size_t len, ProcessorSlot *slots)
+    {
+        uint8_t count = 0;
+        uint8_t deferFrom = Sensor::NUM_PROCESSORS;
+        const size_t total = PipelineSnapshot::check(buf, len, &count, &deferFrom);
+
+        if (total == 0 || count != Sensor::NUM_PROCESSORS || usesSlots(sensor, slots))
+        {
+            return 0;
+        }
+
+        const uint8_t *end = PipelineSnapshot::payloadEnd(buf);
+        const uint8_t *p = PipelineSnapshot::payloadBegin(buf);
+        BaseMeasurementProcessor *built[Sensor::NUM_PROCESSORS];
+        PipelineSnapshot::Record record;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            built[i] = nullptr;
+
+            bool ok = PipelineSnapshot::readRecord(p, end, record);
+
+            if (ok && !record.empty)
+            {
+                built[i] = create(record.config, slots[i].bytes, sizeof(slots[i].bytes), record.extra, record.extraLength);
+                ok = (built[i] != nullptr);
+            }
+
+            if (!ok)
+            {
+                for (uint8_t k = 0; k <= i; k++)
+                {
+                    destroy(built[k]);
+                }
+
+                return 0;
+            }
+        }
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            sensor.setProcessor(i, built[i]);
+        }
+
+        sensor.setDeferredFrom(deferFrom);
+
+        return total;
+    }
+
+    /**
+     * Same as above, but the processors come from sensor.getAllocator() and
+     * are owned by the sensor (previous owned ones go back to the allocator).
+     * Returns 0 without allocator or if the pool runs out (sensor unchanged).
+     */
+    template <class Sensor>
+    static size_t buildSensor(Sensor &sensor, const uint8_t *buf, size_t len)
+    {
+        ProcessorAllocator *allocator = sensor.getAllocator();
+        uint8_t count = 0;
+        uint8_t deferFrom = Sensor::NUM_PROCESSORS;
+        const size_t total = PipelineSnapshot::check(buf, len, &count, &deferFrom);
+
+        if (allocator == nullptr || total == 0 || count != Sensor::NUM_PROCESSORS)
+        {
+            return 0;
+        }
+
+        const uint8_t *end = PipelineSnapshot::payloadEnd(buf);
+        const uint8_t *p = PipelineSnapshot::payloadBegin(buf);
+        BaseMeasurementProcessor *built[Sensor::NUM_PROCESSORS];
+        PipelineSnapshot::Record record;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            built[i] = nullptr;
+
+            bool ok = PipelineSnapshot::readRecord(p, end, record);
+
+            if (ok && !record.empty)
+            {
+                const size_t size = sizeFor(record.config);
+                void *mem = size ? allocator->allocate(size) : nullptr;
+
+                built[i] = create(record.config, mem, size, record.extra, record.extraLength);
+                ok = (built[i] != nullptr);
+
+                if (!ok && mem)
+                {
+                    allocator->release(mem);
+                }
+            }
+
+            if (!ok)
+            {
+                for (uint8_t k = 0; k < i; k++)
+                {
+                    allocator->destroy(built[k]);
+                }
+
+                return 0;
+            }
+        }
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            sensor.adoptProcessor(i, built[i]);
+        }
+
+        sensor.setDeferredFrom(deferFrom);
+
+        return total;
+    }
+
+private:
+    // True if any processor of sensor lives inside slots[0 … NUM_PROCESSORS)
+    template <class Sensor>
+    static bool usesSlots(const Sensor &sensor, const ProcessorSlot *slots)
+    {
+        const uintptr_t first = reinterpret_cast<uintptr_t>(slots);
+        const uintptr_t last = reinterpret_cast<uintptr_t>(slots + Sensor::NUM_PROCESSORS);
+
+        for (uint8_t i = 0; i < Sensor::NUM_PROCESSORS; i++)
+        {
+            const uintptr_t at = reinterpret_cast<uintptr_t>(sensor.processor[i]);
+
+            if (at >= first && at < last)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Placement-new a T into mem if it fits; reports sizeof(T) through needed
+    template <class T, class... Args>
+    static BaseMeasurementProcessor *make(void *mem, size_t size, size_t *needed, Args... args)
+    {
+        if (needed)
+        {
+            *needed = sizeof(T);
+        }
+
+        return (mem && sizeof(T) <= size) ? new (mem) T(args...) : nullptr;
+    }
+
+    // Default-constructed instance of the tagged type; loadConfig() overwrites cfg
+    static BaseMeasurementProcessor *construct(const ProcessorConfig &config, void *mem, size_t size, size_t *needed)
+    {
+        const uint8_t kind = config.u[BaseMeasurementProcessor::POS_PROCESSOR_TYPE];
+        const uint8_t mapper = config.u[BaseMeasurementProcessor::POS_MAPPER_TYPE];
+        const uint8_t sub = config.u[BaseMeasurementProcessor::POS_SUB_TYPE];
+
+        if (kind == BaseMeasurementProcessor::MAPPER && mapper == BaseMapper::FUNCTION)
+        {
+            switch (sub)
+            {
+            case BaseFunctionProcessor::POLYNOMIAL:                    return make<PolynomialMapper>(mem, size, needed);
+            case BaseFunctionProcessor::RTD_CVD_385:                   return make<RTD385>(mem, size, needed);
+            case BaseFunctionProcessor::RTD_CVD_385_SEGMENTED:         return make<RTD385Segmented>(mem, size, needed);
+            case BaseFunctionProcessor::NTC_STEINHART_HART:            return make<NTCSteinhartHart>(mem, size, needed);
+            case BaseFunctionProcessor::THERMOCOUPLE_TYPE_K:           return make<ThermocoupleTypeK>(mem, size, needed);
+            default:                                                   return nullptr;
+            }
+        }
+
+        if (kind == BaseMeasurementProcessor::MAPPER && mapper == BaseMapper::TABLE)
+        {
+            switch (sub)
+            {
+            case BaseTableProcessor::PIECEWISE_LINEAR:                 return make<PiecewiseLinearTable>(mem, size, needed);
+            case BaseTableProcessor::CUBIC_SPLINE:                     return make<CubicSplineTable>(mem, size, needed);
+            case BaseTableProcessor::CUBIC_HERMITE_MONOTONIC_SPLINE:   return make<CubicHermiteMonotonicSplineTable>(mem, size, needed);
+            default:                                                   return nullptr; // UNIFORM_GRID: external table
+            }
+        }
+
+        if (kind == BaseMeasurementProcessor::FILTER)
+        {
+            switch (sub)
+            {
+            case BaseFilter::EXP_MOVING_AVERAGE:                       return make<EMAFilter>(mem, size, needed);
+            case BaseFilter::ADAPTIVE_ABSOLUTE_EMA:                    return make<AdaptiveAbsoluteEMAFilter>(mem, size, needed, 1.0f, 1.0f);
+            case BaseFilter::ALPHA_BETA:                               return make<AlphaBetaFilter>(mem, size, needed, 1.0f, 0.0f);
+            case BaseFilter::KALMAN:                                   return make<KalmanFilter>(mem, size, needed, 1.0f, 0.0f);
+            case BaseFilter::KALMAN_CV:                                return make<KalmanCVFilter>(mem, size, needed, 1.0f, 1.0f);
+            case BaseFilter::MEDIAN3:                                  return make<Median3Filter>(mem, size, needed);
+            case BaseFilter::CIC_DECIMATOR:                            return make<CICDecimatorFilter>(mem, size, needed);
+            default:                                                   return nullptr;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+#endif // PROCESSOR_FACTORY_H
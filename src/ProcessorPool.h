@@ -0,0 +1,145 @@
+#ifndef PROCESSOR_POOL_H
+#define PROCESSOR_POOL_H
+
+#if defined(__AVR__)
+#include <new.h>
+#else
+#include <new>
+#endif
+
+#include "BaseMeasurementProcessor.h"
+#include "SensorLock.h"
+
+/**
+ * Storage provider for processors owned by a sensor (see
+ * BasicGenericSensor::setAllocator() / emplace()). Blocks are 8-byte
+ * aligned; allocate() returns nullptr when it cannot serve the request.
+ */
+class ProcessorAllocator
+{
+public:
+    virtual ~ProcessorAllocator() {}
+
+    virtual void *allocate(size_t size) = 0;
+    virtual void release(void *block) = 0;
+
+    // Construct a T in a fresh block; nullptr if none is available
+    template <class T, class... Args>
+    T *create(Args &&...args)
+    {
+        static_assert(alignof(T) <= 8, "ProcessorAllocator blocks are 8-byte aligned");
+
+        void *mem = allocate(sizeof(T));
+        return mem ? new (mem) T(static_cast<Args &&>(args)...) : nullptr;
+    }
+
+    // Run the destructor and hand the block back
+    void destroy(BaseMeasurementProcessor *proc)
+    {
+        if (proc)
+        {
+            proc->~BaseMeasurementProcessor();
+            release(proc);
+        }
+    }
+};
+
+/**
+ * Fixed pool of COUNT blocks of BLOCK_SIZE bytes in static storage: O(1)
+ * allocate/release through a free-index stack, never touches the heap, so
+ * reconfiguring channels at runtime cannot fragment it. allocate() and
+ * release() are serialised by a SensorLock, so several sensors (and a
+ * remote configuration task) can share one pool.
+ *
+ * BLOCK_SIZE must cover the largest processor placed in the pool;
+ * ProcessorSlot::SIZE (ProcessorFactory.h) covers every factory type.
+ *
+ * Example usage:
+ *     static ProcessorPool<16, 192> pool;
+ *     GenericSensor sensor;
+ *     sensor.setAllocator(&pool);
+ *     sensor.emplace<RTD385>(0, 100.0f);
+ *     sensor.emplace<EMAFilter>(3, 0.1f);
+ *     sensor.emplace<KalmanFilter>(3, 0.25f, 0.001f);   // EMA goes back to the pool
+ */
+template <uint8_t COUNT, size_t BLOCK_SIZE>
+class ProcessorPool : public ProcessorAllocator
+{
+    static_assert(COUNT > 0, "ProcessorPool needs at least one block");
+
+public:
+    static constexpr size_t STRIDE = (BLOCK_SIZE + 7) & ~static_cast<size_t>(7);
+
+private:
+    alignas(8) uint8_t _blocks[COUNT][STRIDE];
+    uint8_t _free[COUNT]; // Stack of free block indices
+    uint8_t _numFree;
+    bool _used[COUNT];
+    SensorLock _lock;
+
+public:
+    explicit ProcessorPool(PushMode mode = PushMode::LOCKED) : _numFree(COUNT), _lock(mode)
+    {
+        for (uint8_t i = 0; i < COUNT; i++)
+        {
+            _free[i] = COUNT - 1 - i; // Hand out block 0 first
+            _used[i] = false;
+        }
+    }
+
+    ProcessorPool(const ProcessorPool &) = delete;
+    ProcessorPool &operator=(const ProcessorPool &) = delete;
+
+    void *allocate(size_t size) override
+    {
+        void *block = nullptr;
+
+        if (size <= BLOCK_SIZE && _lock.take())
+        {
+            if (_numFree > 0)
+            {
+                const uint8_t idx = _free[--_numFree];
+                _used[idx] = true;
+                block = _blocks[idx];
+            }
+
+            _lock.give();
+        }
+
+        return block;
+    }
+
+    // Ignores pointers outside the pool and blocks that are already free
+    void release(void *block) override
+    {
+        if (!owns(block))
+        {
+            return;
+        }
+
+        const uint8_t idx = static_cast<uint8_t>((static_cast<uint8_t *>(block) - _blocks[0]) / STRIDE);
+
+        if (_lock.take())
+        {
+            if (_used[idx])
+            {
+                _used[idx] = false;
+                _free[_numFree++] = idx;
+            }
+
+            _lock.give();
+        }
+    }
+
+    bool owns(const void *block) const
+    {
+        const uint8_t *p = static_cast<const uint8_t *>(block);
+        return p >= _blocks[0] && p < _blocks[0] + COUNT * STRIDE;
+    }
+
+    uint8_t available() const { return _numFree; }
+    static constexpr uint8_t capacity() { return COUNT; }
+    static constexpr size_t blockSize() { return BLOCK_SIZE; }
+};
+
+#endif // PROCESSOR_POOL_H
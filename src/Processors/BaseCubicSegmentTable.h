@@ -0,0 +1,117 @@
+#ifndef BASECUBICSEGMENTTABLE_H
+#define BASECUBICSEGMENTTABLE_H
+
+#include "BaseTableProcessor.h"
+
+/**
+ * Shared evaluation for piecewise-cubic tables.
+ *
+ * Derived classes fit one cubic per segment whenever the table changes and
+ * store it in power form together with the reciprocal segment width:
+ *     seg = { 1/h, a, b, c, d },  p(t) = a + b·t + c·t² + d·t³,  t = (x - x0)/h
+ * apply() is then a segment lookup, one multiply for t and one Horner cubic.
+ * Inputs outside the table are clamped to the end values.
+ */
+class BaseCubicSegmentTable : public BaseTableProcessor
+{
+public:
+    static constexpr uint8_t SEGMENT_FLOATS = 5;
+    static constexpr uint8_t FLOATS_PER_POINT = BaseTableProcessor::FLOATS_PER_POINT + SEGMENT_FLOATS;
+
+protected:
+    uint8_t floatsPerPoint() const override { return FLOATS_PER_POINT; }
+
+    float *cacheData() override { return segments(); }
+
+    inline float *segments()
+    {
+        float *ext = extData();
+        return ext ? ext : _seg;
+    }
+
+    inline void setSegment(uint8_t i, float invH, float a, float b, float c, float d)
+    {
+        float *seg = segments() + SEGMENT_FLOATS * i;
+
+        seg[0] = invH;
+        seg[1] = a;
+        seg[2] = b;
+        seg[3] = c;
+        seg[4] = d;
+    }
+
+    inline float cubicInterpolation(float value)
+    {
+        // Get the number of data points.
+        uint8_t size = tableSize();
+        const float *xs = xData();
+        const float *fs = fxData();
+
+        // --- Boundary Handling ---
+        if (value <= xs[0])
+        {
+            return fs[0];
+        }
+
+        if (value >= xs[size - 1])
+        {
+            return fs[size - 1];
+        }
+
+        // --- Find the correct interval --- (hinted binary search)
+        uint8_t pos = findSegment(xs, size, value);
+
+        // --- Normalized distance t in [0, 1] and one cubic in Horner form ---
+        const float *seg = segments() + SEGMENT_FLOATS * (pos - 1);
+        float t = (value - xs[pos - 1]) * seg[0];
+
+        return seg[1] + t * (seg[2] + t * (seg[3] + t * seg[4]));
+    }
+
+private:
+    // Segment coefficients while the table lives in cfg (caller storage carries its own)
+    float _seg[SEGMENT_FLOATS * (MAX_TABLE_SIZE - 1)];
+
+public:
+    BaseCubicSegmentTable()
+    {
+        for (int i = 0; i < SEGMENT_FLOATS * (MAX_TABLE_SIZE - 1); i++)
+        {
+            _seg[i] = 0.0f;
+        }
+    }
+
+    ~BaseCubicSegmentTable() {}
+
+    float apply(float value) override
+    {
+        if (tableSize() < 2)
+        {
+            return fx(0);
+        }
+
+        return cubicInterpolation(value);
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        if (tableSize() < 2)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                out[i] = fx(0);
+            }
+
+            return n;
+        }
+
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = cubicInterpolation(in[i]);
+        }
+
+        return n;
+    }
+};
+
+#endif // BASECUBICSEGMENTTABLE_H
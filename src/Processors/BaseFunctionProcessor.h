@@ -5,14 +5,18 @@
 
 class BaseFunctionProcessor : public BaseMapper
 {
-protected:
+public:
     enum FunctionType : uint8_t
     {
         NONE,
         POLYNOMIAL,
-        RTD_CVD_385
+        RTD_CVD_385,
+        RTD_CVD_385_SEGMENTED,
+        NTC_STEINHART_HART,
+        THERMOCOUPLE_TYPE_K
     };
 
+protected:
     void setFunctionType(FunctionType type) { cfg.u[POS_SUB_TYPE] = type; }
 
 public:
@@ -3,68 +3,333 @@
 
 #include "BaseMapper.h"
 
+#if !defined(__AVR__)
+#include <atomic>
+#endif
+
+/**
+ * Shared storage and segment search for table-based mappers.
+ *
+ * By default up to MAX_TABLE_SIZE points live inside cfg. Larger calibration
+ * tables (up to 255 points) use caller-owned storage via setStorage(), sized
+ * as FLOATS_PER_POINT × capacity of the concrete table class:
+ *
+ *     static float buf[PiecewiseLinearTable::FLOATS_PER_POINT * 200];
+ *     table.setStorage(buf, sizeof(buf) / sizeof(buf[0]));
+ *
+ * Layout of the caller buffer: x[capacity], fx[capacity], then any per-point
+ * caches of the derived class.
+ */
 class BaseTableProcessor : public BaseMapper
 {
-protected:
+public:
+    // Public so table-type mappers outside this hierarchy can tag themselves
     enum TableType : uint8_t
     {
         NONE,
         PIECEWISE_LINEAR,
         CUBIC_SPLINE,
-        CUBIC_HERMITE_MONOTONIC_SPLINE
+        CUBIC_HERMITE_MONOTONIC_SPLINE,
+        UNIFORM_GRID
     };
 
+    static constexpr uint8_t FLOATS_PER_POINT = 2; // x, fx
+
+protected:
     static constexpr uint8_t MAX_TABLE_SIZE = 8;
     static constexpr uint8_t OFFSET_FX      = 8;
 
-    inline float &x(uint8_t i) { return cfg.f[i]; }
-    inline float &fx(uint8_t i) { return cfg.f[OFFSET_FX + i]; }
+    inline float *xData() { return _ext ? _ext : cfg.f; }
+    inline float *fxData() { return _ext ? _ext + _capacity : cfg.f + OFFSET_FX; }
+    inline const float *xData() const { return _ext ? _ext : cfg.f; }
+    inline const float *fxData() const { return _ext ? _ext + _capacity : cfg.f + OFFSET_FX; }
+
+    // Start of the derived per-point caches in caller storage, nullptr when the
+    // table lives in cfg (derived classes then use their own fixed arrays)
+    inline float *extData() { return _ext ? _ext + 2 * _capacity : nullptr; }
+
+    inline float &x(uint8_t i) { return xData()[i]; }
+    inline float &fx(uint8_t i) { return fxData()[i]; }
 
     inline uint8_t &tableSize() { return cfg.u[POS_TABLE_SIZE]; }
 
     void setTableType(TableType type) { cfg.u[POS_SUB_TYPE] = type; }
 
-private:
-    void sortAscending()
+    // Floats per point the concrete class needs in caller storage
+    virtual uint8_t floatsPerPoint() const { return FLOATS_PER_POINT; }
+
+    // Called after every change of the table points (or their storage)
+    virtual void tableChanged() {}
+
+    // Per-segment caches of the derived class (floatsPerPoint() - 2 floats per
+    // segment, wherever they live), persisted by saveExtra()
+    virtual float *cacheData() { return nullptr; }
+
+    // Floats of cacheData() in use for the current table
+    inline size_t cacheFloats()
     {
-        for (uint8_t i = 0; i < tableSize() - 1; i++)
+        const uint8_t size = tableSize();
+        return (cacheData() && size > 1) ? static_cast<size_t>(size - 1) * (floatsPerPoint() - FLOATS_PER_POINT) : 0;
+    }
+
+    // Table points and caches must fit whatever storage this instance uses
+    bool checkExtra(const uint8_t * /*src*/, uint16_t len) override
+    {
+        return tableSize() <= _capacity && len == (2 * tableSize() + cacheFloats()) * sizeof(float);
+    }
+
+    bool loadExtra(const uint8_t *src, uint16_t /*len*/) override
+    {
+        const uint8_t size = tableSize();
+        const size_t caches = cacheFloats();
+
+        if (size)
+        {
+            memcpy(xData(), src, size * sizeof(float));
+            memcpy(fxData(), src + size * sizeof(float), size * sizeof(float));
+        }
+
+        if (caches)
+        {
+            memcpy(cacheData(), src + 2 * size * sizeof(float), caches * sizeof(float));
+        }
+
+        storeHint(1);
+        return true;
+    }
+
+    /**
+     * Segment index pos in [1, size - 1] such that value lies in
+     * [xs[pos - 1], xs[pos]]: the first point with xs[pos] >= value, clamped
+     * to the outer segments. Tries the last segment and its neighbours first
+     * (consecutive samples rarely jump), then falls back to binary search.
+     * Requires size >= 2. Safe from several reader tasks at once (deferred
+     * stages): the hint is only ever a starting guess.
+     */
+    inline uint8_t findSegment(const float *xs, uint8_t size, float value)
+    {
+        uint8_t h = loadHint();
+
+        if (h < size)
+        {
+            if (inSegment(xs, size, h, value))
+            {
+                return h;
+            }
+
+            if (h + 1 < size && inSegment(xs, size, h + 1, value))
+            {
+                return storeHint(h + 1);
+            }
+
+            if (h > 1 && inSegment(xs, size, h - 1, value))
+            {
+                return storeHint(h - 1);
+            }
+        }
+
+        uint8_t lo = 1;
+        uint8_t hi = size - 1;
+
+        while (lo < hi)
         {
-            for (uint8_t j = i + 1; j < tableSize(); j++)
+            uint8_t mid = (lo + hi) >> 1;
+
+            if (xs[mid] < value)
             {
-                if (x(j) < x(i))
-                {
-                    float temp = x(i);
-                    x(i) = x(j);
-                    x(j) = temp;
-
-                    temp = fx(i);
-                    fx(i) = fx(j);
-                    fx(j) = temp;
-                }
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
             }
         }
+
+        return storeHint(lo);
+    }
+
+private:
+    float *_ext;       // Caller-owned storage, nullptr = cfg
+    uint8_t _capacity; // Points that fit into the current storage
+
+    // Last segment returned by findSegment(). Relaxed atomic, so concurrent
+    // getReading() callers of a deferred table race on a guess, not on UB.
+#if defined(__AVR__)
+    uint8_t _hint;
+
+    inline uint8_t loadHint() const { return _hint; }
+    inline uint8_t storeHint(uint8_t h) { return _hint = h; }
+#else
+    std::atomic<uint8_t> _hint;
+
+    inline uint8_t loadHint() const { return _hint.load(std::memory_order_relaxed); }
+    inline uint8_t storeHint(uint8_t h)
+    {
+        _hint.store(h, std::memory_order_relaxed);
+        return h;
+    }
+#endif
+
+    static inline bool inSegment(const float *xs, uint8_t size, uint8_t pos, float value)
+    {
+        return (pos == 1 || value > xs[pos - 1]) && (pos == size - 1 || value <= xs[pos]);
     }
 
 public:
-    BaseTableProcessor()
+    BaseTableProcessor() : _ext(nullptr), _capacity(MAX_TABLE_SIZE), _hint(1)
     {
         setMapperType(MapperType::TABLE);
     }
 
     ~BaseTableProcessor() {}
 
+    // Move the table into caller-owned storage of numFloats floats.
+    // Returns false if the buffer cannot hold the points already in the table.
+    bool setStorage(float *buffer, size_t numFloats)
+    {
+        size_t cap = numFloats / floatsPerPoint();
+
+        if (cap > 255)
+        {
+            cap = 255;
+        }
+
+        if (buffer == nullptr || cap < tableSize() || cap < 2)
+        {
+            return false;
+        }
+
+        const float *oldX = xData();
+        const float *oldFX = fxData();
+
+        for (uint8_t i = 0; i < tableSize(); i++)
+        {
+            buffer[i] = oldX[i];
+            buffer[cap + i] = oldFX[i];
+        }
+
+        _ext = buffer;
+        _capacity = static_cast<uint8_t>(cap);
+        storeHint(1);
+
+        tableChanged();
+
+        return true;
+    }
+
+    uint8_t getCapacity() const { return _capacity; }
+
+    // x[size], fx[size], then the derived caches: nothing is recomputed on restore
+    uint16_t saveExtra(uint8_t *dst) override
+    {
+        const uint8_t size = tableSize();
+        const size_t caches = cacheFloats();
+
+        if (dst && size)
+        {
+            memcpy(dst, xData(), size * sizeof(float));
+            memcpy(dst + size * sizeof(float), fxData(), size * sizeof(float));
+
+            if (caches)
+            {
+                memcpy(dst + 2 * size * sizeof(float), cacheData(), caches * sizeof(float));
+            }
+        }
+
+        return static_cast<uint16_t>((2 * size + caches) * sizeof(float));
+    }
+
+    // Sorted insert: O(n) shift instead of re-sorting the whole table
     bool pushPoint(const float xValue, const float fxValue)
     {
-        if (tableSize() >= MAX_TABLE_SIZE)
+        if (tableSize() >= _capacity)
         {
             return false;
         }
 
-        x(tableSize()) = xValue;
-        fx(tableSize()) = fxValue;
+        float *xs = xData();
+        float *fs = fxData();
+
+        uint8_t pos = tableSize();
+
+        while (pos > 0 && xs[pos - 1] > xValue)
+        {
+            xs[pos] = xs[pos - 1];
+            fs[pos] = fs[pos - 1];
+            pos--;
+        }
+
+        xs[pos] = xValue;
+        fs[pos] = fxValue;
 
         tableSize()++;
-        sortAscending();
+        storeHint(1);
+
+        tableChanged();
+
+        return true;
+    }
+
+    /**
+     * Replace the whole table with n points (any order): one sort, one cache
+     * rebuild, instead of n pushPoint() calls each shifting the table and
+     * recomputing the slopes. Meant for a staged processor (see
+     * BasicGenericSensor::stagePipeline()). False, table unchanged, if n
+     * exceeds the capacity; validate() then reports duplicate x values.
+     */
+    bool setPoints(const float *xValues, const float *fxValues, uint8_t n)
+    {
+        if (n > _capacity)
+        {
+            return false;
+        }
+
+        float *xs = xData();
+        float *fs = fxData();
+
+        // Insertion sort while copying: linear for the usual pre-sorted input
+        for (uint8_t k = 0; k < n; k++)
+        {
+            uint8_t pos = k;
+
+            while (pos > 0 && xs[pos - 1] > xValues[k])
+            {
+                xs[pos] = xs[pos - 1];
+                fs[pos] = fs[pos - 1];
+                pos--;
+            }
+
+            xs[pos] = xValues[k];
+            fs[pos] = fxValues[k];
+        }
+
+        tableSize() = n;
+        storeHint(1);
+
+        tableChanged();
+
+        return true;
+    }
+
+    // At least two points, strictly increasing finite x, finite values
+    bool validate() const override
+    {
+        const uint8_t size = cfg.u[POS_TABLE_SIZE];
+        const float *xs = xData();
+        const float *fs = fxData();
+
+        if (size < 2)
+        {
+            return false;
+        }
+
+        for (uint8_t i = 0; i < size; i++)
+        {
+            if (!isfinite(xs[i]) || !isfinite(fs[i]) || (i > 0 && !(xs[i] > xs[i - 1])))
+            {
+                return false;
+            }
+        }
 
         return true;
     }
@@ -76,16 +341,59 @@ public:
             return false;
         }
 
+        float *xs = xData();
+        float *fs = fxData();
+
         for (uint8_t i = idx; i < tableSize() - 1; i++)
         {
-            x(i) = x(i + 1);
-            fx(i) = fx(i + 1);
+            xs[i] = xs[i + 1];
+            fs[i] = fs[i + 1];
         }
 
-        x(tableSize() - 1) = 0.0f;
-        fx(tableSize() - 1) = 0.0f;
+        xs[tableSize() - 1] = 0.0f;
+        fs[tableSize() - 1] = 0.0f;
 
         tableSize()--;
+        storeHint(1);
+
+        tableChanged();
+
+        return true;
+    }
+
+    // Breakpoints move to (x - b) / m; needs m > 0 so the table stays sorted
+    bool foldInputAffine(float m, float b) override
+    {
+        if (!(m > 0.0f))
+        {
+            return false;
+        }
+
+        float *xs = xData();
+
+        for (uint8_t i = 0; i < tableSize(); i++)
+        {
+            xs[i] = static_cast<float>((static_cast<double>(xs[i]) - b) / m);
+        }
+
+        storeHint(1);
+
+        tableChanged();
+
+        return true;
+    }
+
+    // Table values become m·fx + b (interpolants are linear in the values)
+    bool foldOutputAffine(float m, float b) override
+    {
+        float *fs = fxData();
+
+        for (uint8_t i = 0; i < tableSize(); i++)
+        {
+            fs[i] = static_cast<float>(static_cast<double>(fs[i]) * m + b);
+        }
+
+        tableChanged();
 
         return true;
     }
@@ -101,4 +409,4 @@ public:
     }
 };
 
-#endif // BASETABLEPROCESSOR_H
\ No newline at end of file
+#endif // BASETABLEPROCESSOR_H
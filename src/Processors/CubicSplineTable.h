@@ -1,26 +1,218 @@
 #ifndef CUBICSPLINETABLE_H
 #define CUBICSPLINETABLE_H
 
-#include "BaseTableProcessor.h"
+#include "BaseCubicSegmentTable.h"
 
-class CubicSplineTable : public BaseTableProcessor
+/**
+ * C2 cubic spline through all table points.
+ *
+ * Boundary conditions:
+ *   - natural (default): f'' = 0 at both ends
+ *   - clamped: f' given at both ends (setClampedBoundary)
+ *
+ * The knot second derivatives M[i] are solved once per table edit with the
+ * Thomas algorithm (O(n) tridiagonal solve); each segment is then stored in
+ * power form, so apply() is a segment lookup plus one cubic evaluation.
+ * Inputs outside the table are clamped to the end values.
+ */
+class CubicSplineTable : public BaseCubicSegmentTable
 {
+public:
+	enum Boundary : uint8_t
+	{
+		NATURAL = 0,
+		CLAMPED
+	};
+
+protected:
+	void tableChanged() override { updateSegments(); }
+
+	// Base table data followed by the clamped end slopes
+	bool checkExtra(const uint8_t *src, uint16_t len) override
+	{
+		const uint16_t own = 2 * sizeof(float);
+
+		return len >= own && BaseCubicSegmentTable::checkExtra(src, len - own);
+	}
+
+	bool loadExtra(const uint8_t *src, uint16_t len) override
+	{
+		const uint16_t own = 2 * sizeof(float);
+
+		if (!BaseCubicSegmentTable::loadExtra(src, len - own))
+		{
+			return false;
+		}
+
+		memcpy(&_slopeStart, src + len - own, sizeof(float));
+		memcpy(&_slopeEnd, src + len - sizeof(float), sizeof(float));
+		return true;
+	}
+
 private:
-	float interpolateCubicSpline(float value)
+	static constexpr uint8_t POS_BOUNDARY = 5;
+
+	float _slopeStart; // f'(x0) for CLAMPED
+	float _slopeEnd;   // f'(xn) for CLAMPED
+
+	inline uint8_t &boundary() { return cfg.u[POS_BOUNDARY]; }
+
+	void updateSegments()
 	{
-		// tbd
-		return value;
+		const uint8_t size = tableSize();
+
+		if (size < 2)
+		{
+			return;
+		}
+
+		const float *xs = xData();
+		const float *fs = fxData();
+		const bool clamped = (boundary() == CLAMPED);
+		const uint8_t n = size - 1;
+
+		// The segment store doubles as scratch for the sweep (no stack sized by the
+		// table): segment i holds { h, delta, cp, M } of point i; M[n] is mLast.
+		float *work = segments();
+
+		// --- Segment widths and slopes ---
+		for (uint8_t i = 0; i < n; i++)
+		{
+			float *w = work + SEGMENT_FLOATS * i;
+
+			w[0] = xs[i + 1] - xs[i];
+			w[1] = (fs[i + 1] - fs[i]) / w[0];
+		}
+
+		// --- Tridiagonal system a[i]·M[i-1] + b[i]·M[i] + c[i]·M[i+1] = d[i] ---
+		// Forward sweep keeps the modified upper diagonal in cp and the rhs in M.
+		// First row: natural M0 = 0, clamped 2h0·M0 + h0·M1 = 6(delta0 - f'(x0))
+		if (clamped)
+		{
+			work[2] = 0.5f;
+			work[3] = 3.0f * (work[1] - _slopeStart) / work[0];
+		}
+		else
+		{
+			work[2] = 0.0f;
+			work[3] = 0.0f;
+		}
+
+		for (uint8_t i = 1; i < n; i++)
+		{
+			const float *prev = work + SEGMENT_FLOATS * (i - 1);
+			float *cur = work + SEGMENT_FLOATS * i;
+			float a = prev[0];
+			float b = 2.0f * (prev[0] + cur[0]);
+			float d = 6.0f * (cur[1] - prev[1]);
+			float w = b - a * prev[2];
+
+			cur[2] = cur[0] / w;
+			cur[3] = (d - a * prev[3]) / w;
+		}
+
+		// Last row: natural M(n) = 0, clamped h·M(n-1) + 2h·M(n) = 6(f'(xn) - delta)
+		const float *last = work + SEGMENT_FLOATS * (n - 1);
+		float mLast = 0.0f;
+
+		if (clamped)
+		{
+			float a = last[0];
+			float w = 2.0f * last[0] - a * last[2];
+			mLast = (6.0f * (_slopeEnd - last[1]) - a * last[3]) / w;
+		}
+
+		// --- Back substitution ---
+		float mNext = mLast;
+
+		for (int i = n - 1; i >= 0; i--)
+		{
+			float *cur = work + SEGMENT_FLOATS * i;
+
+			cur[3] -= cur[2] * mNext;
+			mNext = cur[3];
+		}
+
+		// --- Power form per segment in t = (x - x0)/h ---
+		// p(t) = y0 + (h·delta - h²(2M0 + M1)/6)·t + (h²M0/2)·t² + (h²(M1 - M0)/6)·t³
+		// Segment i overwrites only its own scratch; M1 is read from segment i + 1.
+		for (uint8_t i = 0; i < n; i++)
+		{
+			const float *cur = work + SEGMENT_FLOATS * i;
+			float h = cur[0];
+			float delta = cur[1];
+			float m0 = cur[3];
+			float m1 = (i + 1 < n) ? cur[SEGMENT_FLOATS + 3] : mLast;
+			float h2 = h * h;
+
+			setSegment(i,
+					   1.0f / h,
+					   fs[i],
+					   h * delta - h2 * (2.0f * m0 + m1) / 6.0f,
+					   0.5f * h2 * m0,
+					   h2 * (m1 - m0) / 6.0f);
+		}
 	}
 
 public:
-	CubicSplineTable() { setTableType(TableType::CUBIC_SPLINE); }
+	CubicSplineTable() : _slopeStart(0.0f), _slopeEnd(0.0f)
+	{
+		setTableType(TableType::CUBIC_SPLINE);
+		boundary() = NATURAL;
+	}
+
 	~CubicSplineTable() {}
 
-	// Performs cubic spline interpolation based on table data.
-	float apply(float value) override
+	void setNaturalBoundary()
+	{
+		boundary() = NATURAL;
+		updateSegments();
+	}
+
+	// End derivatives f'(x0) and f'(xn) in output units per input unit
+	void setClampedBoundary(float slopeStart, float slopeEnd)
 	{
-		return interpolateCubicSpline(value);
+		_slopeStart = slopeStart;
+		_slopeEnd = slopeEnd;
+		boundary() = CLAMPED;
+		updateSegments();
+	}
+
+	Boundary getBoundary() { return static_cast<Boundary>(boundary()); }
+
+	// Clamped end slopes scale with m in both directions
+	bool foldInputAffine(float m, float b) override
+	{
+		if (!BaseCubicSegmentTable::foldInputAffine(m, b))
+		{
+			return false;
+		}
+
+		_slopeStart *= m;
+		_slopeEnd *= m;
+		updateSegments();
+		return true;
+	}
+
+	bool foldOutputAffine(float m, float b) override
+	{
+		_slopeStart *= m;
+		_slopeEnd *= m;
+		return BaseCubicSegmentTable::foldOutputAffine(m, b);
+	}
+
+	uint16_t saveExtra(uint8_t *dst) override
+	{
+		const uint16_t base = BaseCubicSegmentTable::saveExtra(dst);
+
+		if (dst)
+		{
+			memcpy(dst + base, &_slopeStart, sizeof(float));
+			memcpy(dst + base + sizeof(float), &_slopeEnd, sizeof(float));
+		}
+
+		return base + 2 * sizeof(float);
 	}
 };
 
-#endif // CUBICSPLINETABLE_H
\ No newline at end of file
+#endif // CUBICSPLINETABLE_H
@@ -0,0 +1,264 @@
+#ifndef LOOKUPTABLEMAPPER_H
+#define LOOKUPTABLEMAPPER_H
+
+#include "BaseTableProcessor.h"
+
+/**
+ * Input:  any value inside [x0, x1]
+ * Output: source(value), linearly interpolated from a uniform grid
+ *
+ * Replaces an expensive mapper (e.g. RTD385 with its sqrtf/Horner branches)
+ * by an O(1) table lookup: one subtract, one multiply, one float→int
+ * conversion and one linear interpolation. No search, no divide.
+ *
+ * The table is either sampled from a source mapper at construction into a
+ * caller-provided buffer, or wraps a pre-sampled table in flash (PROGMEM),
+ * e.g. one printed once with printTable(). Inputs outside [x0, x1] are
+ * clamped to the table ends.
+ *
+ * Example usage:
+ *     RTD385 rtd(100.0f);
+ *     static float lut[512];
+ *     LookupTableMapper fast(rtd, 80.0f, 150.0f, lut, 512);
+ *     float tempC = fast.apply(resistance_ohms);  // fast.getMaxError() ≈ interpolation error
+ */
+class LookupTableMapper : public BaseMapper
+{
+private:
+    // Accessors into cfg storage
+    inline float &x0()       { return cfg.f[0]; }
+    inline float &x1()       { return cfg.f[1]; }
+    inline float &invStep()  { return cfg.f[2]; }  // (size - 1) / (x1 - x0)
+    inline float &lastPos()  { return cfg.f[3]; }  // size - 1, as float
+    inline float &maxError() { return cfg.f[4]; }
+
+    const float *_table;
+    float *_samples; // Writable buffer of the sampling constructor, else nullptr
+    uint16_t _size;
+    bool _progmem;
+
+    inline float sample(uint16_t i) const
+    {
+        return _progmem ? pgm_read_float(&_table[i]) : _table[i];
+    }
+
+    inline float lookup(float value)
+    {
+        float pos = constrain((value - x0()) * invStep(), 0.0f, lastPos());
+
+        uint16_t i = static_cast<uint16_t>(pos);
+        if (i > _size - 2)
+        {
+            i = _size - 2;
+        }
+
+        float y0 = sample(i);
+        return y0 + (pos - i) * (sample(i + 1) - y0);
+    }
+
+    void setRange(float xStart, float xEnd)
+    {
+        x0() = xStart;
+        x1() = xEnd;
+        lastPos() = static_cast<float>(_size - 1);
+        invStep() = (_size >= 2 && xEnd != xStart) ? lastPos() / (xEnd - xStart) : 0.0f;
+    }
+
+protected:
+    // Grid size, then the samples of a sampled table (wrapped tables are not copied)
+    bool checkExtra(const uint8_t *src, uint16_t len) override
+    {
+        uint16_t size = 0;
+
+        if (len < sizeof(size))
+        {
+            return false;
+        }
+
+        memcpy(&size, src, sizeof(size));
+
+        const size_t samples = (len - sizeof(size)) / sizeof(float);
+
+        return size == _size && (len - sizeof(size)) % sizeof(float) == 0 && (samples == 0 || (samples == _size && _samples));
+    }
+
+    bool loadExtra(const uint8_t *src, uint16_t len) override
+    {
+        const size_t samples = (len - sizeof(uint16_t)) / sizeof(float);
+
+        if (samples)
+        {
+            memcpy(_samples, src + sizeof(uint16_t), samples * sizeof(float));
+        }
+
+        return true;
+    }
+
+public:
+    // Sample source over [xStart, xEnd] onto size uniformly spaced points in buffer
+    LookupTableMapper(BaseMeasurementProcessor &source, float xStart, float xEnd, float *buffer, uint16_t size)
+        : _table(buffer), _samples(buffer), _size(size), _progmem(false)
+    {
+        setMapperType(MapperType::TABLE);
+        cfg.u[POS_SUB_TYPE] = BaseTableProcessor::UNIFORM_GRID;
+        setRange(xStart, xEnd);
+
+        if (_size >= 2)
+        {
+            float step = (xEnd - xStart) / lastPos();
+
+            for (uint16_t i = 0; i < _size; i++)
+            {
+                buffer[i] = source.apply(xStart + step * i);
+            }
+
+            estimateMaxError(source);
+        }
+    }
+
+    // Empty table over buffer, to be filled by loadConfig() from a snapshot
+    // instead of re-sampling the source at boot
+    LookupTableMapper(float *buffer, uint16_t size)
+        : _table(buffer), _samples(buffer), _size(size), _progmem(false)
+    {
+        setMapperType(MapperType::TABLE);
+        cfg.u[POS_SUB_TYPE] = BaseTableProcessor::UNIFORM_GRID;
+        setRange(0.0f, 0.0f);
+
+        for (uint16_t i = 0; i < _size; i++)
+        {
+            buffer[i] = 0.0f;
+        }
+    }
+
+    // Wrap a pre-sampled table; inProgmem selects pgm_read_float() access
+    LookupTableMapper(const float *table, uint16_t size, float xStart, float xEnd, bool inProgmem = true)
+        : _table(table), _samples(nullptr), _size(size), _progmem(inProgmem)
+    {
+        setMapperType(MapperType::TABLE);
+        cfg.u[POS_SUB_TYPE] = BaseTableProcessor::UNIFORM_GRID;
+        setRange(xStart, xEnd);
+    }
+
+    ~LookupTableMapper() {}
+
+    float apply(float value) override
+    {
+        if (_size < 2)
+        {
+            return value;
+        }
+
+        return lookup(value);
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        if (_size < 2)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                out[i] = in[i];
+            }
+
+            return n;
+        }
+
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = lookup(in[i]);
+        }
+
+        return n;
+    }
+
+    // The grid moves to (x - b) / m: same lookup cost, no extra stage (m > 0)
+    bool foldInputAffine(float m, float b) override
+    {
+        if (!(m > 0.0f))
+        {
+            return false;
+        }
+
+        x0() = static_cast<float>((static_cast<double>(x0()) - b) / m);
+        x1() = static_cast<float>((static_cast<double>(x1()) - b) / m);
+        invStep() *= m;
+        return true;
+    }
+
+    // Max |table(x) - reference(x)| probed at probesPerCell points inside every
+    // grid cell (the grid nodes themselves are exact). Stored for getMaxError().
+    float estimateMaxError(BaseMeasurementProcessor &reference, uint8_t probesPerCell = 8)
+    {
+        float err = 0.0f;
+
+        if (_size >= 2 && probesPerCell > 0)
+        {
+            float step = (x1() - x0()) / lastPos();
+            float dt = step / (probesPerCell + 1);
+
+            for (uint16_t i = 0; i < _size - 1; i++)
+            {
+                float xc = x0() + step * i;
+
+                for (uint8_t k = 1; k <= probesPerCell; k++)
+                {
+                    float x = xc + dt * k;
+                    float e = fabsf(lookup(x) - reference.apply(x));
+
+                    if (e > err)
+                    {
+                        err = e;
+                    }
+                }
+            }
+        }
+
+        maxError() = err;
+        return err;
+    }
+
+    uint16_t saveExtra(uint8_t *dst) override
+    {
+        const size_t samples = _samples ? _size : 0;
+        const size_t bytes = sizeof(_size) + samples * sizeof(float);
+
+        if (dst)
+        {
+            memcpy(dst, &_size, sizeof(_size));
+
+            if (samples)
+            {
+                memcpy(dst + sizeof(_size), _table, samples * sizeof(float));
+            }
+        }
+
+        return static_cast<uint16_t>(bytes);
+    }
+
+    float getMaxError() { return maxError(); }
+    uint16_t getSize() const { return _size; }
+    float getXStart() { return x0(); }
+    float getXEnd() { return x1(); }
+
+    // Emit the table as a PROGMEM C array, e.g. to freeze a sampled table into flash
+    void printTable(Print &out, const char *name)
+    {
+        out.print("static const float ");
+        out.print(name);
+        out.print("[");
+        out.print(static_cast<unsigned>(_size));
+        out.println("] PROGMEM = {");
+
+        for (uint16_t i = 0; i < _size; i++)
+        {
+            out.print("    ");
+            out.print(sample(i), 7);
+            out.println((i + 1 < _size) ? "f," : "f");
+        }
+
+        out.println("};");
+    }
+};
+
+#endif // LOOKUPTABLEMAPPER_H
@@ -0,0 +1,178 @@
+#ifndef NTC_STEINHART_HART_H
+#define NTC_STEINHART_HART_H
+
+#include <string.h>
+#include "BaseFunctionProcessor.h"
+
+/**
+ * Input:  resistance in ohms (Ω) of an NTC thermistor
+ * Output: temperature in °C
+ *
+ * Implements the Steinhart–Hart equation:
+ *   1/T = A + B·ln(R) + C·ln(R)³       (T in K)
+ *
+ * ln(R) comes from a branch-free fast log instead of logf(): the exponent
+ * is taken from the float bits, the mantissa is reduced to [0.75, 1.5) and
+ * ln(1 + t) is a degree-6 minimax polynomial in Horner form (absolute error
+ * 2.4 × 10⁻⁶, i.e. about 5 × 10⁻⁵ K for typical NTCs, where dT/d(ln R) ≈ 20 K).
+ * One divide remains for 1/T.
+ *
+ * Coefficients:
+ *   – setCoefficients(A, B, C) from the datasheet,
+ *   – setFromPoints() solves them from three (°C, Ω) calibration points,
+ *   – setBeta(R25, β) for a β-only datasheet (C = 0).
+ * The default is the common 10 kΩ @ 25 °C thermistor set.
+ *
+ * Notes:
+ *   – foldInputAffine(m, b) merges a linear counts → Ω stage, as RTD385 does.
+ *     A voltage divider is not linear in counts; map it to Ω first.
+ *   – Inputs below 1 Ω (shorted or negative) are clamped to 1 Ω.
+ *
+ * Example usage:
+ *     NTCSteinhartHart ntc;
+ *     ntc.setBeta(10000.0f, 3950.0f);
+ *     float tempC = ntc.apply(resistance_ohms);
+ */
+class NTCSteinhartHart : public BaseFunctionProcessor
+{
+public:
+    explicit NTCSteinhartHart(float a = 1.129148e-3f, float b = 2.34125e-4f, float c = 8.76741e-8f)
+    {
+        setCoefficients(a, b, c);
+        inGain()   = 1.0f;
+        inOffset() = 0.0f;
+
+        setFunctionType(FunctionType::NTC_STEINHART_HART);
+    }
+
+    void setCoefficients(float a, float b, float c)
+    {
+        A() = a;
+        B() = b;
+        C() = c;
+    }
+
+    // β model: 1/T = 1/T0 + ln(R/R0)/β, i.e. C = 0
+    void setBeta(float r0, float beta, float t0C = 25.0f)
+    {
+        const double invT0 = 1.0 / (static_cast<double>(t0C) + KELVIN);
+
+        setCoefficients(static_cast<float>(invT0 - log(static_cast<double>(r0)) / beta), static_cast<float>(1.0 / beta), 0.0f);
+    }
+
+    // Exact fit through three (°C, Ω) points; false if they are degenerate
+    bool setFromPoints(float t1C, float r1, float t2C, float r2, float t3C, float r3)
+    {
+        if (!(r1 > 0.0f && r2 > 0.0f && r3 > 0.0f))
+        {
+            return false;
+        }
+
+        const double l1 = log(static_cast<double>(r1));
+        const double l2 = log(static_cast<double>(r2));
+        const double l3 = log(static_cast<double>(r3));
+        const double y1 = 1.0 / (static_cast<double>(t1C) + KELVIN);
+        const double y2 = 1.0 / (static_cast<double>(t2C) + KELVIN);
+        const double y3 = 1.0 / (static_cast<double>(t3C) + KELVIN);
+
+        if (l1 == l2 || l2 == l3 || l1 == l3)
+        {
+            return false;
+        }
+
+        const double g2 = (y2 - y1) / (l2 - l1);
+        const double g3 = (y3 - y1) / (l3 - l1);
+        const double c = (g3 - g2) / (l3 - l2) / (l1 + l2 + l3);
+        const double b = g2 - c * (l1 * l1 + l1 * l2 + l2 * l2);
+        const double a = y1 - (b + l1 * l1 * c) * l1;
+
+        setCoefficients(static_cast<float>(a), static_cast<float>(b), static_cast<float>(c));
+        return true;
+    }
+
+    // The resistance is taken from R = gain·x + offset: absorbs a linear front end
+    bool foldInputAffine(float m, float b) override
+    {
+        inOffset() = inGain() * b + inOffset();
+        inGain()  *= m;
+        return true;
+    }
+
+    float apply(float R) override
+    {
+        return convert(R * inGain() + inOffset(), A(), B(), C());
+    }
+
+    // Straight-line loop: auto-vectorizes with -fno-math-errno -fno-trapping-math, like RTD385::applyBatch()
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        // Local copies so nothing in the loop can alias out[]
+        const float gain = inGain();
+        const float offset = inOffset();
+        const float a = A();
+        const float b = B();
+        const float c = C();
+
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = convert(in[i] * gain + offset, a, b, c);
+        }
+
+        return n;
+    }
+
+    // Branch-free ln(x) for x > 0 (normal floats), absolute error ≤ 2.4e-6
+    static inline float fastLog(float x)
+    {
+        uint32_t bits;
+        memcpy(&bits, &x, sizeof(bits));
+
+        // Exponent relative to 0.75, so the mantissa lands in [0.75, 1.5)
+        const int32_t e = static_cast<int32_t>(bits - 0x3F400000UL) >> 23;
+        bits -= static_cast<uint32_t>(e) << 23;
+
+        float m;
+        memcpy(&m, &bits, sizeof(m));
+
+        const float t = m - 1.0f;
+        float p = LOG1P[6];
+        p = p * t + LOG1P[5];
+        p = p * t + LOG1P[4];
+        p = p * t + LOG1P[3];
+        p = p * t + LOG1P[2];
+        p = p * t + LOG1P[1];
+        p = p * t + LOG1P[0];
+
+        return p + static_cast<float>(e) * LN2;
+    }
+
+private:
+    // Accessors into cfg storage
+    inline float &A() { return cfg.f[0]; }
+    inline float &B() { return cfg.f[1]; }
+    inline float &C() { return cfg.f[2]; }
+    inline float &inGain()   { return cfg.f[3]; } // Folded input stage: R = gain·x + offset
+    inline float &inOffset() { return cfg.f[4]; }
+
+    static constexpr double KELVIN = 273.15;
+    static constexpr float LN2 = 0.693147182f;
+    static constexpr float R_MIN = 1.0f; // Clamp for shorted or negative inputs
+
+    // Minimax ln(1 + t) on [−0.25, 0.5]
+    static constexpr float LOG1P[7] = {
+        -1.115356213e-06f, 9.999874830e-01f, -4.997706711e-01f, 3.338889182e-01f,
+        -2.578194141e-01f, 2.033547908e-01f, -1.000559255e-01f
+    };
+
+    static inline float convert(float r, float a, float b, float c)
+    {
+        r = (r < R_MIN) ? R_MIN : r;
+
+        const float l = fastLog(r);
+        const float invT = a + l * (b + l * l * c);
+
+        return 1.0f / invT - static_cast<float>(KELVIN);
+    }
+};
+
+#endif // NTC_STEINHART_HART_H
@@ -5,12 +5,50 @@
 
 class PiecewiseLinearTable : public BaseTableProcessor
 {
+public:
+    static constexpr uint8_t FLOATS_PER_POINT = BaseTableProcessor::FLOATS_PER_POINT + 1; // + segment slope
+
+protected:
+    uint8_t floatsPerPoint() const override { return FLOATS_PER_POINT; }
+
+    void tableChanged() override { updateSlopes(); }
+
+    float *cacheData() override { return slopes(); }
+
 private:
+    // Slope of segment i (between points i and i + 1) while the table lives in cfg
+    float _slope[MAX_TABLE_SIZE];
+
+    inline float *slopes()
+    {
+        float *ext = extData();
+        return ext ? ext : _slope;
+    }
+
+    // Precompute segment slopes once per table edit so apply() is divide-free
+    void updateSlopes()
+    {
+        const uint8_t size = tableSize();
+        const float *xs = xData();
+        const float *fs = fxData();
+        float *k = slopes();
+
+        for (uint8_t i = 0; i + 1 < size; i++)
+        {
+            float dx = xs[i + 1] - xs[i];
+            k[i] = (dx != 0.0f) ? (fs[i + 1] - fs[i]) / dx : 0.0f;
+        }
+    }
+
     inline float piecewiseLinearInterpolation(float value)
     {
-        if (tableSize() < 2)
+        const uint8_t size = tableSize();
+        const float *xs = xData();
+        const float *fs = fxData();
+
+        if (size < 2)
         {
-            return fx(0);
+            return fs[0];
         }
 
         /*
@@ -25,28 +63,42 @@ private:
         }
             */
 
-        uint8_t pos = 1;
-        while (value > x(pos) && pos < tableSize() - 1)
-        {
-            pos++;
-        }
+        uint8_t pos = findSegment(xs, size, value);
 
-        if (value == x(pos))
+        if (value == xs[pos])
         {
-            return fx(pos);
+            return fs[pos];
         }
 
-        return (value - x(pos - 1)) * (fx(pos) - fx(pos - 1)) / (x(pos) - x(pos - 1)) + fx(pos - 1);
+        return (value - xs[pos - 1]) * slopes()[pos - 1] + fs[pos - 1];
     }
 
 public:
-    PiecewiseLinearTable() { setTableType(TableType::PIECEWISE_LINEAR); }
+    PiecewiseLinearTable()
+    {
+        setTableType(TableType::PIECEWISE_LINEAR);
+
+        for (int i = 0; i < MAX_TABLE_SIZE; i++)
+        {
+            _slope[i] = 0.0f;
+        }
+    }
     ~PiecewiseLinearTable() {}
 
     float apply(float value) override
     {
         return piecewiseLinearInterpolation(value);
     }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = piecewiseLinearInterpolation(in[i]);
+        }
+
+        return n;
+    }
 };
 
 #endif // PIECEWISELINEARTABLE_H
\ No newline at end of file
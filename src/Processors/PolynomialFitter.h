@@ -0,0 +1,483 @@
+#ifndef POLYNOMIALFITTER_H
+#define POLYNOMIALFITTER_H
+
+#include "PolynomialMapper.h"
+
+// Exact model for PolynomialFitter, evaluated in double (e.g. the CVD inverse)
+typedef double (*FitFunction)(double x, void *context);
+
+/**
+ * Minimax polynomial generator: finds the lowest-degree PolynomialMapper
+ * that reproduces any processor (RTD385 with any R0, thermocouple or NTC
+ * models, tables) over [x0, x1] within a requested max error.
+ *
+ * For each degree from 1 up, the Remez exchange algorithm runs in double
+ * precision on the Chebyshev basis over the mapped interval [-1, 1],
+ * starting from the Chebyshev extrema; the result is converted to the power
+ * basis in x that PolynomialMapper evaluates. The error is then measured on
+ * the float mapper itself, against the float source, on a dense grid: the
+ * reported error is what apply() delivers, float rounding of the power-basis
+ * coefficients and of Horner's scheme included. Over ranges far from zero
+ * (e.g. Ω) that rounding grows with the degree, so the search keeps the
+ * best degree when none meets the tolerance.
+ *
+ * A processor source is itself float (RTD385 is good to ~3e-4 °C), which
+ * bounds the achievable error; fitting against a FitFunction in double
+ * (the exact model) can beat the float source.
+ *
+ * Runs once at init (each Remez iteration evaluates the source on
+ * GRID_POINTS points), or offline: printHeader() emits a class in the style
+ * of RTD385_5C45C_PT100 to paste into a header.
+ *
+ * Example usage (Pt1000, 0 … 200 °C, 1 m°C against the float RTD385):
+ *     RTD385 pt1000(1000.0f);
+ *     PolynomialMapper fast;
+ *     float err;
+ *     if (PolynomialFitter::fit(pt1000, 1000.0f, 1758.4f, 0.001f, fast, &err)) { sensor.setMapper(0, &fast); }
+ *     PolynomialFitter::printHeader(Serial, "RTD385_0C200C_PT1000", fast, 1000.0f, 1758.4f, err);
+ */
+class PolynomialFitter
+{
+public:
+    static constexpr uint8_t MAX_DEGREE = 7;
+    static constexpr uint16_t GRID_POINTS = 2048; // Error scan of one Remez iteration
+    static constexpr uint8_t MAX_ITERATIONS = 30;
+    static constexpr double CONVERGENCE = 1e-3;   // Relative spread of the error extrema
+
+    /**
+     * Lowest degree ≤ maxDegree whose float evaluation stays within
+     * tolerance of source on [x0, x1]; written to out. Returns false (out
+     * then holds the most accurate degree tried) if none meets the tolerance.
+     * maxError receives the measured error of out.
+     */
+    static bool fit(BaseMeasurementProcessor &source, float x0, float x1, float tolerance, PolynomialMapper &out,
+                    float *maxError = nullptr, uint8_t maxDegree = MAX_DEGREE)
+    {
+        ProcessorSource f = {source};
+        return search(f, x0, x1, tolerance, out, maxError, maxDegree);
+    }
+
+    // Same against an exact model in double
+    static bool fit(FitFunction function, void *context, float x0, float x1, float tolerance, PolynomialMapper &out,
+                    float *maxError = nullptr, uint8_t maxDegree = MAX_DEGREE)
+    {
+        FunctionSource f = {function, context};
+        return search(f, x0, x1, tolerance, out, maxError, maxDegree);
+    }
+
+    // Max |candidate - reference| on probes + 1 evenly spaced points of [x0, x1]
+    static float verify(BaseMeasurementProcessor &reference, BaseMeasurementProcessor &candidate, float x0, float x1,
+                        uint16_t probes = 4 * GRID_POINTS)
+    {
+        ProcessorSource f = {reference};
+        return measure(f, candidate, x0, x1, probes);
+    }
+
+    static float verify(FitFunction function, void *context, BaseMeasurementProcessor &candidate, float x0, float x1,
+                        uint16_t probes = 4 * GRID_POINTS)
+    {
+        FunctionSource f = {function, context};
+        return measure(f, candidate, x0, x1, probes);
+    }
+
+    // C++ class for poly, ready to paste into a header
+    static void printHeader(Print &out, const char *className, const PolynomialMapper &poly, float x0, float x1, float maxError)
+    {
+        const ProcessorConfig &config = poly.getConfig();
+        const uint8_t numCoeffs = config.u[BaseMeasurementProcessor::POS_DEGREE] + 1;
+
+        out.println("/**");
+        out.print(" * Minimax polynomial fit, degree ");
+        out.print(static_cast<int>(numCoeffs - 1));
+        out.println(" (PolynomialFitter)");
+        out.print(" *     Range: ");
+        out.print(x0, 6);
+        out.print(" ... ");
+        out.println(x1, 6);
+        out.print(" *     Maximum absolute error: ");
+        printScientific(out, maxError, 3);
+        out.println("");
+        out.println(" */");
+        out.print("class ");
+        out.print(className);
+        out.println(" : public PolynomialMapper {");
+        out.println("private:");
+        out.print("    static constexpr uint8_t NUM_COEFFS = ");
+        out.print(static_cast<int>(numCoeffs));
+        out.println(";");
+        out.print("    static constexpr float COEFFS[NUM_COEFFS] = {");
+
+        for (uint8_t i = 0; i < numCoeffs; i++)
+        {
+            printScientific(out, config.f[i], 10);
+            out.print("f");
+            out.print((i + 1 < numCoeffs) ? ", " : "");
+        }
+
+        out.println("};");
+        out.println("");
+        out.println("public:");
+        out.print("    ");
+        out.print(className);
+        out.println("() noexcept");
+        out.println("    {");
+        out.println("        setDegree(NUM_COEFFS - 1);");
+        out.println("        for (uint8_t i = 0; i < NUM_COEFFS; ++i) { setCoefficient(i, COEFFS[i]); }");
+        out.println("    }");
+        out.println("};");
+    }
+
+private:
+    static constexpr uint8_t MAX_POINTS = MAX_DEGREE + 2; // Remez reference size
+    static constexpr uint8_t MAX_EXTREMA = 64;            // Sign runs kept during a scan
+
+    struct Extremum
+    {
+        double t;
+        double e;
+    };
+
+    struct ProcessorSource
+    {
+        BaseMeasurementProcessor &proc;
+
+        double operator()(double x) const { return proc.apply(static_cast<float>(x)); }
+    };
+
+    struct FunctionSource
+    {
+        FitFunction function;
+        void *context;
+
+        double operator()(double x) const { return function(x, context); }
+    };
+
+    // Lowest degree meeting tolerance, else the best one tried
+    template <class Source>
+    static bool search(Source &source, float x0, float x1, float tolerance, PolynomialMapper &out, float *maxError, uint8_t maxDegree)
+    {
+        if (!(x1 > x0))
+        {
+            return false;
+        }
+
+        maxDegree = (maxDegree > MAX_DEGREE) ? MAX_DEGREE : (maxDegree < 1 ? 1 : maxDegree);
+
+        float best = INFINITY;
+        uint8_t bestDegree = 1;
+        double bestCheb[MAX_DEGREE + 1] = {};
+
+        for (uint8_t deg = 1; deg <= maxDegree; deg++)
+        {
+            double cheb[MAX_DEGREE + 1];
+
+            remez(source, x0, x1, deg, cheb);
+            store(cheb, deg, x0, x1, out);
+
+            const float err = measure(source, out, x0, x1, 4 * GRID_POINTS);
+
+            if (err < best)
+            {
+                best = err;
+                bestDegree = deg;
+                memcpy(bestCheb, cheb, sizeof(cheb));
+            }
+
+            if (err <= tolerance)
+            {
+                break;
+            }
+        }
+
+        store(bestCheb, bestDegree, x0, x1, out);
+
+        if (maxError)
+        {
+            *maxError = best;
+        }
+
+        return best <= tolerance;
+    }
+
+    template <class Source>
+    static float measure(Source &source, BaseMeasurementProcessor &candidate, float x0, float x1, uint16_t probes)
+    {
+        double err = 0.0;
+
+        for (uint16_t i = 0; i <= probes; i++)
+        {
+            const float x = static_cast<float>(x0 + (static_cast<double>(x1) - x0) * i / probes);
+            const double e = fabs(candidate.apply(x) - source(x));
+
+            err = (e > err) ? e : err;
+        }
+
+        return static_cast<float>(err);
+    }
+
+    // Source at t ∈ [-1, 1] mapped onto [x0, x1]
+    template <class Source>
+    static inline double sourceAt(Source &source, double t, double mid, double half)
+    {
+        return source(mid + half * t);
+    }
+
+    // Σ c[j]·T_j(t), Clenshaw recurrence
+    static double chebyshev(const double *c, uint8_t deg, double t)
+    {
+        double b1 = 0.0;
+        double b2 = 0.0;
+
+        for (int j = deg; j >= 1; j--)
+        {
+            const double b0 = 2.0 * t * b1 - b2 + c[j];
+            b2 = b1;
+            b1 = b0;
+        }
+
+        return t * b1 - b2 + c[0];
+    }
+
+    // Thin a sign-alternating extremum list down to keep entries, dropping
+    // the smallest ones without breaking the alternation
+    static uint8_t reduce(Extremum *list, uint8_t count, uint8_t keep)
+    {
+        while (count > keep)
+        {
+            uint8_t k = 0;
+
+            for (uint8_t i = 1; i < count; i++)
+            {
+                if (fabs(list[i].e) < fabs(list[k].e))
+                {
+                    k = i;
+                }
+            }
+
+            if (k != 0 && k != count - 1 && count - keep == 1)
+            {
+                // One too many: only an end can go without two equal signs meeting
+                k = (fabs(list[0].e) < fabs(list[count - 1].e)) ? 0 : count - 1;
+            }
+
+            if (k == 0 || k == count - 1)
+            {
+                for (uint8_t i = k; i + 1 < count; i++) { list[i] = list[i + 1]; }
+                count--;
+                continue;
+            }
+
+            // Interior: drop it and the smaller of its (now adjacent, same-sign) neighbours
+            const uint8_t drop = (fabs(list[k - 1].e) < fabs(list[k + 1].e)) ? k - 1 : k + 1;
+            const uint8_t first = (drop < k) ? drop : k;
+
+            for (uint8_t i = first; i + 2 < count; i++) { list[i] = list[i + 2]; }
+            count -= 2;
+        }
+
+        return count;
+    }
+
+    // Solve the (n + 2)×(n + 2) Remez system in place (partial pivoting)
+    static bool solve(double a[MAX_POINTS][MAX_POINTS + 1], uint8_t n)
+    {
+        for (uint8_t col = 0; col < n; col++)
+        {
+            uint8_t pivot = col;
+
+            for (uint8_t r = col + 1; r < n; r++)
+            {
+                if (fabs(a[r][col]) > fabs(a[pivot][col])) { pivot = r; }
+            }
+
+            if (a[pivot][col] == 0.0)
+            {
+                return false;
+            }
+
+            for (uint8_t k = 0; k <= n; k++)
+            {
+                const double tmp = a[col][k];
+                a[col][k] = a[pivot][k];
+                a[pivot][k] = tmp;
+            }
+
+            for (uint8_t r = 0; r < n; r++)
+            {
+                if (r == col) { continue; }
+
+                const double f = a[r][col] / a[col][col];
+
+                for (uint8_t k = col; k <= n; k++) { a[r][k] -= f * a[col][k]; }
+            }
+        }
+
+        for (uint8_t r = 0; r < n; r++)
+        {
+            a[r][n] /= a[r][r];
+        }
+
+        return true;
+    }
+
+    // Chebyshev coefficients c[0..deg] of the minimax fit over t ∈ [-1, 1]
+    template <class Source>
+    static void remez(Source &source, float x0, float x1, uint8_t deg, double *c)
+    {
+        const double mid = 0.5 * (static_cast<double>(x0) + x1);
+        const double half = 0.5 * (static_cast<double>(x1) - x0);
+        const uint8_t n = deg + 2;
+        double ref[MAX_POINTS];
+
+        for (uint8_t k = 0; k < n; k++)
+        {
+            ref[k] = -cos(PI * k / (n - 1));
+        }
+
+        for (uint8_t it = 0; it < MAX_ITERATIONS; it++)
+        {
+            // Σ c_j·T_j(t_k) + (-1)^k·E = f(t_k)
+            double a[MAX_POINTS][MAX_POINTS + 1];
+
+            for (uint8_t k = 0; k < n; k++)
+            {
+                double tPrev = 1.0;
+                double tCur = ref[k];
+
+                a[k][0] = 1.0;
+
+                for (uint8_t j = 1; j <= deg; j++)
+                {
+                    a[k][j] = tCur;
+                    const double tNext = 2.0 * ref[k] * tCur - tPrev;
+                    tPrev = tCur;
+                    tCur = tNext;
+                }
+
+                a[k][deg + 1] = (k & 1) ? -1.0 : 1.0;
+                a[k][n] = sourceAt(source, ref[k], mid, half);
+            }
+
+            if (!solve(a, n))
+            {
+                return;
+            }
+
+            for (uint8_t j = 0; j <= deg; j++)
+            {
+                c[j] = a[j][n];
+            }
+
+            const double levelled = fabs(a[deg + 1][n]);
+
+            // Error scan: one extremum per sign run
+            Extremum list[MAX_EXTREMA];
+            uint8_t count = 0;
+            double worst = 0.0;
+
+            for (uint16_t i = 0; i < GRID_POINTS; i++)
+            {
+                const double t = -1.0 + 2.0 * i / (GRID_POINTS - 1);
+                const double e = sourceAt(source, t, mid, half) - chebyshev(c, deg, t);
+
+                worst = (fabs(e) > worst) ? fabs(e) : worst;
+
+                if (count > 0 && (e >= 0.0) == (list[count - 1].e >= 0.0))
+                {
+                    if (fabs(e) > fabs(list[count - 1].e)) { list[count - 1] = {t, e}; }
+                    continue;
+                }
+
+                if (count == MAX_EXTREMA)
+                {
+                    count = reduce(list, count, MAX_EXTREMA / 2);
+                }
+
+                list[count++] = {t, e};
+            }
+
+            // Fewer alternations than unknowns: the fit is already exact to
+            // the source's own rounding
+            if (count < n || worst - levelled <= CONVERGENCE * worst)
+            {
+                return;
+            }
+
+            count = reduce(list, count, n);
+
+            for (uint8_t k = 0; k < n; k++)
+            {
+                ref[k] = list[k].t;
+            }
+        }
+    }
+
+    // Chebyshev series in t = (x - mid) / half → power basis in x, rounded once to float
+    static void store(const double *c, uint8_t deg, float x0, float x1, PolynomialMapper &out)
+    {
+        const double mid = 0.5 * (static_cast<double>(x0) + x1);
+        const double half = 0.5 * (static_cast<double>(x1) - x0);
+
+        double inT[MAX_DEGREE + 1] = {};
+        double tPrev[MAX_DEGREE + 1] = {1.0};
+        double tCur[MAX_DEGREE + 1] = {0.0, 1.0};
+
+        inT[0] = c[0];
+
+        for (uint8_t j = 1; j <= deg; j++)
+        {
+            for (uint8_t k = 0; k <= j; k++) { inT[k] += c[j] * tCur[k]; }
+
+            // T_{j+1} = 2t·T_j - T_{j-1}
+            double tNext[MAX_DEGREE + 1] = {};
+
+            for (uint8_t k = 0; k + 1 <= MAX_DEGREE && k <= j; k++) { tNext[k + 1] = 2.0 * tCur[k]; }
+            for (uint8_t k = 0; k <= MAX_DEGREE; k++) { tNext[k] -= tPrev[k]; }
+            for (uint8_t k = 0; k <= MAX_DEGREE; k++) { tPrev[k] = tCur[k]; tCur[k] = tNext[k]; }
+        }
+
+        // Substitute t = m·x + b (Horner expansion, as in foldInputAffine())
+        const double m = 1.0 / half;
+        const double b = -mid / half;
+        double q[MAX_DEGREE + 1] = {};
+
+        q[0] = inT[deg];
+
+        for (int i = deg - 1; i >= 0; i--)
+        {
+            for (int k = deg - i; k > 0; k--) { q[k] = q[k] * b + q[k - 1] * m; }
+            q[0] = q[0] * b + inT[i];
+        }
+
+        out.setDegree(deg);
+
+        for (uint8_t k = 0; k <= deg; k++)
+        {
+            out.setCoefficient(k, static_cast<float>(q[k]));
+        }
+    }
+
+    static void printScientific(Print &out, double v, uint8_t digits)
+    {
+        if (v == 0.0)
+        {
+            out.print("0.0");
+            return;
+        }
+
+        int exponent = static_cast<int>(floor(log10(fabs(v))));
+        double mantissa = v / pow(10.0, exponent);
+
+        if (fabs(mantissa) >= 10.0)
+        {
+            mantissa /= 10.0;
+            exponent++;
+        }
+
+        out.print(mantissa, digits);
+        out.print(exponent < 0 ? "e-" : "e+");
+        out.print(exponent < 0 ? -exponent : exponent);
+    }
+};
+
+#endif // POLYNOMIALFITTER_H
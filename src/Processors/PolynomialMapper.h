@@ -9,6 +9,23 @@ protected:
     inline float &c(uint8_t i) { return cfg.f[i]; }
     inline uint8_t &degree() {return cfg.u[POS_DEGREE]; }
 
+    static constexpr uint8_t MAX_COEFFS = 8;
+
+    // Non-virtual Horner evaluation shared by apply() and derived mappers
+    inline float horner(float value)
+    {
+        uint8_t deg = degree();
+
+        float result = c(deg);
+
+        for (int i = deg - 1; i >= 0; i--)
+        {
+            result = result * value + c(i);
+        }
+
+        return result;
+    }
+
 public:
     PolynomialMapper()
     {
@@ -23,20 +40,59 @@ public:
 
     float apply(float value) override
     {
-        uint8_t deg = degree();
+        return horner(value);
+    }
 
-        float result = c(deg);
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        // Local coefficient copy: out[] cannot alias cfg, so the loop stays in registers
+        const uint8_t deg = degree();
+        float k[MAX_COEFFS];
 
-        for (int i = deg - 1; i >= 0; i--)
+        for (uint8_t i = 0; i <= deg; i++)
         {
-            result = result * value + c(i);
+            k[i] = c(i);
         }
 
-        return result;
+        for (size_t j = 0; j < n; j++)
+        {
+            const float x = in[j];
+            float result = k[deg];
+
+            for (int i = deg - 1; i >= 0; i--)
+            {
+                result = result * x + k[i];
+            }
+
+            out[j] = result;
+        }
+
+        return n;
     }
 
     uint8_t getDegree() { return degree(); }
 
+    // Degree in range (checked first, it bounds the loop) and finite coefficients
+    bool validate() const override
+    {
+        const uint8_t deg = cfg.u[POS_DEGREE];
+
+        if (deg >= MAX_COEFFS)
+        {
+            return false;
+        }
+
+        for (uint8_t i = 0; i <= deg; i++)
+        {
+            if (!isfinite(cfg.f[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     bool setDegree(uint8_t deg)
     {
         if (deg > 7) { return false; }
@@ -59,6 +115,59 @@ public:
         setCoefficient(1, m); // slope term
     }
 
+    bool getAffine(float &m, float &b) const override
+    {
+        if (cfg.u[POS_DEGREE] > 1)
+        {
+            return false;
+        }
+
+        m = (cfg.u[POS_DEGREE] == 1) ? cfg.f[1] : 0.0f;
+        b = cfg.f[0];
+        return true;
+    }
+
+    // p(m·x + b) expanded by Horner's scheme in double: one float rounding per
+    // coefficient. High degrees over a wide input range lose accuracy in the
+    // expanded form; fold those into a normalized input instead.
+    bool foldInputAffine(float m, float b) override
+    {
+        const uint8_t deg = degree();
+        double q[MAX_COEFFS] = {};
+
+        q[0] = c(deg);
+
+        for (int i = deg - 1; i >= 0; i--)
+        {
+            // q = q·(m·x + b) + c(i), from the top coefficient down
+            for (int k = deg - i; k > 0; k--)
+            {
+                q[k] = q[k] * b + q[k - 1] * m;
+            }
+
+            q[0] = q[0] * b + c(i);
+        }
+
+        for (uint8_t k = 0; k <= deg; k++)
+        {
+            c(k) = static_cast<float>(q[k]);
+        }
+
+        return true;
+    }
+
+    bool foldOutputAffine(float m, float b) override
+    {
+        const uint8_t deg = degree();
+
+        for (uint8_t k = 0; k <= deg; k++)
+        {
+            c(k) = static_cast<float>(static_cast<double>(c(k)) * m + ((k == 0) ? b : 0.0));
+        }
+
+        return true;
+    }
+
 };
 
 #endif // POLYNOMIALMAPPER_H
\ No newline at end of file
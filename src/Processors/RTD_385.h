@@ -24,6 +24,8 @@
  * Notes:
  *   – Uses a normalized resistance ratio R/R0 for scaling.
  *   – Adjust R0 via setR0().
+ *   – foldInputAffine(m, b) merges an ADC counts → Ω stage into the
+ *     normalization: r = (m·x + b)/R0 becomes one multiply-add.
  *   – Works for any nominal RTD (Pt100, Pt500, Pt1000) with α = 0.00385.
  */
 class RTD385 : public PolynomialMapper
@@ -36,6 +38,8 @@ public:
         A()  = CVD_A;
         B()  = CVD_B;
         C()  = CVD_C;
+        inGain()   = 1.0f;
+        inOffset() = 0.0f;
 
         setR0(r0);
         setDegree(NUM_COEFFS - 1);
@@ -46,22 +50,117 @@ public:
         setFunctionType(FunctionType::RTD_CVD_385);
     }
 
+protected:
+    // The positive-branch constants are derived from R0, A and B in cfg
+    bool loadExtra(const uint8_t * /*src*/, uint16_t /*len*/) override
+    {
+        setR0(R0());
+        return true;
+    }
+
+public:
     // Set R0 and recalculate all precomputed coefficients based on R0.
     void setR0(float r0)
     {
         R0()       = r0;
-        invR0      = 1.0f / R0();
+        rScale     = static_cast<float>(static_cast<double>(inGain()) / R0());   // input → R/R0, folded
+        rOffset    = static_cast<float>(static_cast<double>(inOffset()) / R0()); // affine stage included
         b          = A() * R0();                   // linear coefficient (A·R0)
         inv2a      = 1.0f / (2.0f * B() * R0());   // reciprocal of 2a = 2B·R0
         b_squared  = b * b;                        // cache b²
         a4         = 4.0f * B() * R0();            // 4a = 4B·R0
     }
 
+    // The ratio is taken from R = gain·x + offset: absorbs a linear front end
+    bool foldInputAffine(float m, float b) override
+    {
+        inOffset() = inGain() * b + inOffset();
+        inGain()  *= m;
+        setR0(R0());
+        return true;
+    }
+
+    bool getAffine(float & /*m*/, float & /*b*/) const override { return false; }
+    bool foldOutputAffine(float /*m*/, float /*b*/) override { return false; }
+
+    bool validate() const override
+    {
+        return PolynomialMapper::validate() && cfg.f[8] > 0.0f && isfinite(rScale) && isfinite(rOffset);
+    }
+
     float apply(float R) override
     {
         // Normalize and clamp to valid range
-        float r = constrain(R * invR0, RATIO_MIN, RATIO_MAX);
-        return (r < 1.0f) ? PolynomialMapper::apply(r) : T_from_r_pos(r);
+        float r = constrain(R * rScale + rOffset, RATIO_MIN, RATIO_MAX);
+        return (r < 1.0f) ? horner(r) : T_from_r_pos(r);
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        applyBatch(in, out, n);
+        return n;
+    }
+
+    /**
+     * Branchless batch conversion R[i] (Ω) → T[i] (°C), R and T may alias.
+     *
+     * Both branches are evaluated for every sample and blended with a select,
+     * so the loop has no control flow and auto-vectorizes (SSE/NEON/Helium).
+     * GCC needs -fno-math-errno -fno-trapping-math for that: otherwise sqrtf
+     * may set errno/raise and the selects are not if-converted, and the loop
+     * stays scalar (still branch-free and faster than apply()). The positive-branch
+     * discriminant stays > 0 for r < 1, so the unused branch never yields NaN.
+     * Operation order matches apply(): results are identical unless the
+     * compiler contracts the vector and scalar paths into FMAs differently.
+     */
+    void applyBatch(const float *R, float *T, size_t n)
+    {
+        if (degree() != NUM_COEFFS - 1)
+        {
+            // Coefficients were reconfigured: keep the generic Horner loop
+            for (size_t i = 0; i < n; i++)
+            {
+                T[i] = apply(R[i]);
+            }
+
+            return;
+        }
+
+        // Local copies so nothing in the loop can alias T[]
+        float k[NUM_COEFFS];
+        for (uint8_t i = 0; i < NUM_COEFFS; i++) { k[i] = c(i); }
+
+        const float scale = rScale;
+        const float offset = rOffset;
+        const float r0 = R0();
+        const float nb = -b;
+        const float bb = b_squared;
+        const float a4_ = a4;
+        const float i2a = inv2a;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            // Same clamp as constrain(), written as two selects
+            float r = R[i] * scale + offset;
+            r = (r < RATIO_MIN) ? RATIO_MIN : r;
+            r = (r > RATIO_MAX) ? RATIO_MAX : r;
+
+            // Negative branch: Horner, fully unrolled
+            float neg = k[7];
+            neg = neg * r + k[6];
+            neg = neg * r + k[5];
+            neg = neg * r + k[4];
+            neg = neg * r + k[3];
+            neg = neg * r + k[2];
+            neg = neg * r + k[1];
+            neg = neg * r + k[0];
+
+            // Positive branch: quadratic inverse
+            float d = bb - a4_ * (r0 * (1.0f - r));
+            float pos = (nb + sqrtf(d)) * i2a;
+
+            T[i] = (r < 1.0f) ? neg : pos;
+        }
     }
 
 private:
@@ -70,13 +169,16 @@ private:
     inline float &A()  { return cfg.f[9]; }
     inline float &B()  { return cfg.f[10]; }
     inline float &C()  { return cfg.f[11]; }
+    inline float &inGain()   { return cfg.f[12]; } // Folded input stage: R = gain·x + offset
+    inline float &inOffset() { return cfg.f[13]; }
 
     // Precomputed values for positive-branch inversion
     float b;           // A·R0
     float inv2a;       // 1 / (2·B·R0)
     float b_squared;   // (A·R0)²
     float a4;          // 4·B·R0
-    float invR0;       // 1 / R0
+    float rScale;      // gain / R0
+    float rOffset;     // offset / R0
 
     // ---- IEC 60751 constants ----
     static constexpr float CVD_A =  3.9083e-3f;
@@ -103,6 +205,151 @@ private:
     }
 };
 
+/**
+ * Input:  resistance in ohms (Ω) of a platinum RTD with α = 0.00385 (IEC 60751)
+ * Output: temperature in °C
+ *
+ * Full-range inverse Callendar–Van Dusen (CVD) equation without sqrt or
+ * divide: −200 °C … +850 °C is split into NUM_SEGMENTS equal intervals of
+ * the normalized ratio r = R/R0, each covered by a cubic minimax polynomial
+ * (PolynomialFitter against the exact inverse, C term included below 0 °C).
+ *
+ * Evaluation:
+ *     s = (r − RATIO_MIN) · NUM_SEGMENTS / (RATIO_MAX − RATIO_MIN)
+ *     i = ⌊s⌋, u = s − i ∈ [0, 1]
+ *     T ≈ k0[i] + u·(k1[i] + u·(k2[i] + u·k3[i]))
+ * The ratio scaling, R0 and an optional folded input stage collapse into a
+ * single multiply-add; index and clamping are selects, so a conversion is
+ * 4 multiply-adds and one table fetch at any temperature.
+ *
+ * Fit details:
+ *     Segments: 16, degree 3 (64 constant floats)
+ *     Maximum absolute error: 1.6 × 10⁻⁴ °C (float evaluation included),
+ *     1.9 × 10⁻⁴ °C with the float rounding of R
+ *
+ * Notes:
+ *   – Outside −200 … +850 °C the input is clamped to the range ends.
+ *   – Works for any nominal RTD (Pt100, Pt500, Pt1000), set R0 via setR0().
+ *   – foldInputAffine(m, b) merges an ADC counts → Ω stage into the index
+ *     computation, as RTD385 does.
+ *
+ * Example usage:
+ *     RTD385Segmented pt1000(1000.0f);
+ *     float tempC = pt1000.apply(resistance_ohms);
+ */
+class RTD385Segmented : public BaseFunctionProcessor
+{
+public:
+    static constexpr uint8_t NUM_SEGMENTS = 16;
+
+    explicit RTD385Segmented(float r0 = 100.0f)
+    {
+        inGain()   = 1.0f;
+        inOffset() = 0.0f;
+
+        setR0(r0);
+        setFunctionType(FunctionType::RTD_CVD_385_SEGMENTED);
+    }
+
+protected:
+    // The index scaling is derived from R0 and the input stage in cfg
+    bool loadExtra(const uint8_t * /*src*/, uint16_t /*len*/) override
+    {
+        setR0(R0());
+        return true;
+    }
+
+public:
+    void setR0(float r0)
+    {
+        const double perRatio = NUM_SEGMENTS / (static_cast<double>(RATIO_MAX) - RATIO_MIN);
+
+        R0()    = r0;
+        sScale  = static_cast<float>(static_cast<double>(inGain()) / r0 * perRatio);                     // input → s
+        sOffset = static_cast<float>((static_cast<double>(inOffset()) / r0 - RATIO_MIN) * perRatio);
+    }
+
+    float getR0() const { return cfg.f[0]; }
+
+    bool validate() const override { return cfg.f[0] > 0.0f && isfinite(sScale) && isfinite(sOffset); }
+
+    // The index is taken from R = gain·x + offset: absorbs a linear front end
+    bool foldInputAffine(float m, float b) override
+    {
+        inOffset() = inGain() * b + inOffset();
+        inGain()  *= m;
+        setR0(R0());
+        return true;
+    }
+
+    float apply(float R) override
+    {
+        return segment(R * sScale + sOffset);
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        const float scale = sScale;
+        const float offset = sOffset;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = segment(in[i] * scale + offset);
+        }
+
+        return n;
+    }
+
+private:
+    // Accessors into cfg storage
+    inline float &R0()       { return cfg.f[0]; }
+    inline float &inGain()   { return cfg.f[1]; } // Folded input stage: R = gain·x + offset
+    inline float &inOffset() { return cfg.f[2]; }
+
+    float sScale;  // gain / (R0 · segment width)
+    float sOffset; // (offset / R0 − RATIO_MIN) / segment width
+
+    // Normalized R/R0 range for −200 … +850 °C (CVD, C term below 0 °C)
+    static constexpr float RATIO_MIN = 0.1852008f;
+    static constexpr float RATIO_MAX = 3.90481125f;
+
+    // s ∈ [0, NUM_SEGMENTS] after clamping; the top end uses the last segment at u = 1
+    static inline float segment(float s)
+    {
+        // Per segment k0 … k3 in u = s − i. Function-local: a constexpr member
+        // array indexed at run time needs an out-of-class definition before C++17
+        static const float COEFFS[NUM_SEGMENTS][4] = {
+            {-1.999999847e+02f, 5.377157974e+01f, 1.228397131e+00f, -8.515465260e-02f},
+            {-1.450852051e+02f, 5.597338867e+01f, 9.675823450e-01f, -8.138503134e-02f},
+            {-8.822566223e+01f, 5.766751480e+01f, 7.185336947e-01f, -5.621213093e-02f},
+            {-2.989590836e+01f, 5.894287109e+01f, 5.394055247e-01f, -6.213411689e-03f},
+            {2.958030701e+01f, 6.000717163e+01f, 5.364812016e-01f, 1.004817151e-02f},
+            {9.013401031e+01f, 6.111040115e+01f, 5.665947795e-01f, 1.102524158e-02f},
+            {1.518220367e+02f, 6.227680588e+01f, 5.996338129e-01f, 1.214068662e-02f},
+            {2.147106171e+02f, 6.351265717e+01f, 6.360120773e-01f, 1.342076249e-02f},
+            {2.788727112e+02f, 6.482512665e+01f, 6.762217283e-01f, 1.489807945e-02f},
+            {3.443889465e+02f, 6.622248077e+01f, 7.208521962e-01f, 1.661350392e-02f},
+            {4.113489075e+02f, 6.771427917e+01f, 7.706147432e-01f, 1.861875132e-02f},
+            {4.798524170e+02f, 6.931166077e+01f, 8.263748288e-01f, 2.097995207e-02f},
+            {5.500114136e+02f, 7.102770233e+01f, 8.891947865e-01f, 2.378266864e-02f},
+            {6.219520874e+02f, 7.287785339e+01f, 9.603916407e-01f, 2.713900432e-02f},
+            {6.958175049e+02f, 7.488056946e+01f, 1.041615605e+00f, 3.119792230e-02f},
+            {7.717708740e+02f, 7.705801392e+01f, 1.134959459e+00f, 3.616047651e-02f}
+        };
+
+        s = (s < 0.0f) ? 0.0f : s;
+        s = (s > static_cast<float>(NUM_SEGMENTS)) ? static_cast<float>(NUM_SEGMENTS) : s;
+
+        int i = static_cast<int>(s);
+        i = (i < NUM_SEGMENTS) ? i : NUM_SEGMENTS - 1;
+
+        const float u = s - static_cast<float>(i);
+        const float *k = COEFFS[i];
+
+        return k[0] + u * (k[1] + u * (k[2] + u * k[3]));
+    }
+};
+
 /**
  * Input:  resistance in ohms (Ω) of a platinum RTD with α = 0.00385 (IEC 60751)
  * Output: temperature in °C
@@ -0,0 +1,199 @@
+#ifndef THERMOCOUPLE_TYPE_K_H
+#define THERMOCOUPLE_TYPE_K_H
+
+#include "BaseFunctionProcessor.h"
+
+/**
+ * Input:  type K thermocouple voltage in millivolts (mV), as measured
+ * Output: hot-junction temperature in °C
+ *
+ * Implements the NIST ITS-90 inverse polynomials for type K:
+ *   T = d0 + d1·E + … + d9·E⁹
+ * over three ranges, −200 … 0 °C, 0 … 500 °C and 500 … 1372 °C
+ * (−5.891 … 54.886 mV); NIST inverse error ±0.06 °C at most.
+ *
+ * Cold-junction compensation: setColdJunction(°C) evaluates the NIST
+ * forward (T → E) polynomial, exponential term included, in double once
+ * and folds the junction voltage into the input offset. A sample then
+ * costs one multiply-add for E = gain·x + offset, two selects for the range
+ * and one 9th-degree Horner pass over the selected coefficient row; no
+ * branches, so applyBlock() is a straight loop.
+ *
+ * Notes:
+ *   – foldInputAffine(m, b) merges a linear ADC counts (or V) → mV stage.
+ *   – The cold-junction update is a single float store, safe to call from
+ *     another task at the CJ sensor rate. In a SensorGraph, link the CJ
+ *     sensor to side input SIDE_COLD_JUNCTION instead.
+ *   – Voltages outside the NIST range are clamped to its ends.
+ *
+ * Example usage:
+ *     ThermocoupleTypeK tc;
+ *     tc.setColdJunction(boardTempC);
+ *     float tempC = tc.apply(millivolts);
+ */
+class ThermocoupleTypeK : public BaseFunctionProcessor
+{
+public:
+    static constexpr uint8_t SIDE_COLD_JUNCTION = 0; // setSideInput() channel, °C
+
+    ThermocoupleTypeK()
+    {
+        inGain()       = 1.0f;
+        inOffset()     = 0.0f;
+        coldJunction() = 0.0f;
+
+        setColdJunction(0.0f);
+        setFunctionType(FunctionType::THERMOCOUPLE_TYPE_K);
+    }
+
+protected:
+    // The junction offset is derived from the CJ temperature in cfg
+    bool loadExtra(const uint8_t * /*src*/, uint16_t /*len*/) override
+    {
+        setColdJunction(coldJunction());
+        return true;
+    }
+
+public:
+    // Reference-junction temperature in °C (−270 … 1372 °C)
+    void setColdJunction(float tC)
+    {
+        coldJunction() = tC;
+        eOffset = static_cast<float>(inOffset() + forward(tC));
+    }
+
+    float getColdJunction() const { return cfg.f[2]; }
+
+    // Cold junction from another sensor (SensorGraph); unchanged values skip the forward polynomial
+    bool setSideInput(uint8_t channel, float value) override
+    {
+        if (channel != SIDE_COLD_JUNCTION)
+        {
+            return false;
+        }
+
+        if (value != coldJunction())
+        {
+            setColdJunction(value);
+        }
+
+        return true;
+    }
+
+    // NIST forward polynomial: thermoelectric voltage in mV at tC (0 °C reference)
+    static double forward(double tC)
+    {
+        // NIST ITS-90 type K forward coefficients c0 … c10 (mV, °C), T < 0 and T ≥ 0
+        static const double FORWARD[2][11] = {
+            {
+                 0.000000000000e+00,  0.394501280250e-01,  0.236223735980e-04, -0.328589067840e-06,
+                -0.499048287770e-08, -0.675090591730e-10, -0.574103274280e-12, -0.310888728940e-14,
+                -0.104516093650e-16, -0.198892668780e-19, -0.163226974860e-22
+            },
+            {
+                -0.176004136860e-01,  0.389212049750e-01,  0.185587700320e-04, -0.994575928740e-07,
+                 0.318409457190e-09, -0.560728448890e-12,  0.560750590590e-15, -0.320207200030e-18,
+                 0.971511471520e-22, -0.121047212750e-25,  0.0
+            }
+        };
+
+        const double *c = FORWARD[tC >= 0.0];
+        double e = c[10];
+
+        for (int i = 9; i >= 0; i--)
+        {
+            e = e * tC + c[i];
+        }
+
+        if (tC >= 0.0)
+        {
+            const double d = tC - EXP_A2;
+            e += EXP_A0 * exp(EXP_A1 * d * d);
+        }
+
+        return e;
+    }
+
+    // The voltage is taken from E = gain·x + offset: absorbs a linear front end
+    bool foldInputAffine(float m, float b) override
+    {
+        inOffset() = inGain() * b + inOffset();
+        inGain()  *= m;
+        setColdJunction(coldJunction());
+        return true;
+    }
+
+    float apply(float mV) override
+    {
+        return inverse(mV * inGain() + eOffset);
+    }
+
+    size_t applyBlock(const float *in, float *out, size_t n) override
+    {
+        // Local copies so nothing in the loop can alias out[]
+        const float gain = inGain();
+        const float offset = eOffset;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = inverse(in[i] * gain + offset);
+        }
+
+        return n;
+    }
+
+private:
+    // Accessors into cfg storage
+    inline float &inGain()       { return cfg.f[0]; } // Folded input stage: E = gain·x + offset
+    inline float &inOffset()     { return cfg.f[1]; }
+    inline float &coldJunction() { return cfg.f[2]; }
+
+    float eOffset; // offset + E(cold junction), mV
+
+    // NIST inverse range limits, mV (E(−200 °C), E(500 °C), E(1372 °C))
+    static constexpr float E_MIN = -5.8914f;
+    static constexpr float E_MID = 20.644f;
+    static constexpr float E_MAX = 54.8864f;
+
+    static constexpr uint8_t NUM_COEFFS = 10;
+
+    // Exponential term a0·exp(a1·(T − a2)²) for T ≥ 0 °C
+    static constexpr double EXP_A0 =  0.118597600000e+00;
+    static constexpr double EXP_A1 = -0.118343200000e-03;
+    static constexpr double EXP_A2 =  0.126968600000e+03;
+
+    static inline float inverse(float e)
+    {
+        // NIST ITS-90 type K inverse coefficients d0 … d9, one row per range.
+        // Function-local, like the forward table: a constexpr member array
+        // indexed at run time needs an out-of-class definition before C++17
+        static const float INVERSE[3][NUM_COEFFS] = {
+            { 0.0f,          2.5173462e+01f, -1.1662878e+00f, -1.0833638e+00f, -8.9773540e-01f,
+             -3.7342377e-01f, -8.6632643e-02f, -1.0450598e-02f, -5.1920577e-04f, 0.0f},
+            { 0.0f,          2.508355e+01f,   7.860106e-02f,  -2.503131e-01f,   8.315270e-02f,
+             -1.228034e-02f,  9.804036e-04f,  -4.413030e-05f,   1.057734e-06f,  -1.052755e-08f},
+            {-1.318058e+02f, 4.830222e+01f,  -1.646031e+00f,   5.464731e-02f,  -9.650715e-04f,
+              8.802193e-06f, -3.110810e-08f,   0.0f,            0.0f,            0.0f}
+        };
+
+        e = (e < E_MIN) ? E_MIN : e;
+        e = (e > E_MAX) ? E_MAX : e;
+
+        const float *d = INVERSE[(e >= 0.0f) + (e >= E_MID)];
+
+        float t = d[9];
+        t = t * e + d[8];
+        t = t * e + d[7];
+        t = t * e + d[6];
+        t = t * e + d[5];
+        t = t * e + d[4];
+        t = t * e + d[3];
+        t = t * e + d[2];
+        t = t * e + d[1];
+        t = t * e + d[0];
+
+        return t;
+    }
+};
+
+#endif // THERMOCOUPLE_TYPE_K_H
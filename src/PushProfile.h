@@ -0,0 +1,104 @@
+#ifndef PUSH_PROFILE_H
+#define PUSH_PROFILE_H
+
+#include <Arduino.h>
+#include "CycleCounter.h"
+
+// Min / max / mean of a series of cycle counts (CycleCounter ticks)
+struct CycleStats
+{
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t count;
+
+    CycleStats() { reset(); }
+
+    void reset()
+    {
+        min = UINT32_MAX;
+        max = 0;
+        sum = 0;
+        count = 0;
+    }
+
+    inline void record(uint32_t cycles)
+    {
+        if (cycles < min) { min = cycles; }
+        if (cycles > max) { max = cycles; }
+
+        sum += cycles;
+        count++;
+    }
+
+    float mean() const { return count ? static_cast<float>(sum) / count : 0.0f; }
+
+    float meanNs() const { return count ? CycleCounter::toNs(1) * mean() : 0.0f; }
+};
+
+/**
+ * Timing of a sensor pipeline, filled by push()/pushBlock() when the library
+ * is built with GENERIC_SENSOR_PROFILING defined:
+ *   stage[i]  cycles spent in processor slot i (empty slots stay at count 0)
+ *   lockWait  cycles between entering push() and owning the producer lock
+ *   total     whole push() latency, lock wait included
+ *
+ * pushBlock() records one entry per chunk, normalised to cycles per sample.
+ */
+template <uint8_t NUM_PROCESSORS>
+struct PushProfile
+{
+    CycleStats stage[NUM_PROCESSORS];
+    CycleStats lockWait;
+    CycleStats total;
+
+    void reset()
+    {
+        for (uint8_t i = 0; i < NUM_PROCESSORS; i++)
+        {
+            stage[i].reset();
+        }
+
+        lockWait.reset();
+        total.reset();
+    }
+
+    // One line per slot plus lock wait and total, in cycles
+    void print(Print &out) const
+    {
+        for (uint8_t i = 0; i < NUM_PROCESSORS; i++)
+        {
+            out.print("stage ");
+            out.print(static_cast<unsigned>(i));
+            out.print(": ");
+            printStats(out, stage[i]);
+        }
+
+        out.print("lock:    ");
+        printStats(out, lockWait);
+        out.print("total:   ");
+        printStats(out, total);
+    }
+
+private:
+    static void printStats(Print &out, const CycleStats &s)
+    {
+        if (s.count == 0)
+        {
+            out.println("-");
+            return;
+        }
+
+        out.print("min ");
+        out.print(static_cast<unsigned long>(s.min));
+        out.print(" / mean ");
+        out.print(s.mean(), 1);
+        out.print(" / max ");
+        out.print(static_cast<unsigned long>(s.max));
+        out.print(" cycles (n = ");
+        out.print(static_cast<unsigned long>(s.count));
+        out.println(")");
+    }
+};
+
+#endif // PUSH_PROFILE_H
@@ -0,0 +1,191 @@
+#ifndef SAMPLE_HISTORY_H
+#define SAMPLE_HISTORY_H
+
+#include <Arduino.h>
+
+#if !defined(__AVR__)
+#include <atomic>
+#endif
+
+// One history entry: micros() timestamp and final value of a push
+struct TimedSample
+{
+    uint32_t timeUs;
+    float value;
+};
+
+/**
+ * Ring of TimedSample entries written by a sensor's push() and drained by
+ * one reader without copying.
+ *
+ * The reader asks peek() for the longest contiguous run of unread entries
+ * (at most two calls per drain, because of the wrap), hands that pointer
+ * and length straight to SD / network / DMA, then consume()s it. The writer
+ * never overwrites unread entries: when the ring is full new samples are
+ * dropped and counted in getOverruns(), so a span being read stays valid
+ * until it is consumed.
+ *
+ * Capacity is a power of two (the constructor rounds down); on AVR at most
+ * 128 entries, so the single-byte indices stay atomic.
+ *
+ * Example usage (logger drains once per second):
+ *     static StaticSampleHistory<1024> history;
+ *     sensor.setHistory(&history);
+ *     ...
+ *     const TimedSample *run;
+ *     size_t n;
+ *     while ((n = history.peek(run)) > 0) { file.write((const uint8_t *)run, n * sizeof(TimedSample)); history.consume(n); }
+ */
+class SampleHistory
+{
+private:
+#if defined(__AVR__)
+    typedef uint8_t Index;
+
+    volatile Index _head; // Published entries (writer)
+    volatile Index _tail; // Consumed entries (reader)
+
+    inline Index loadHead() const { __asm__ __volatile__("" ::: "memory"); return _head; }
+    inline Index loadTail() const { __asm__ __volatile__("" ::: "memory"); return _tail; }
+    inline void storeHead(Index v) { __asm__ __volatile__("" ::: "memory"); _head = v; }
+    inline void storeTail(Index v) { __asm__ __volatile__("" ::: "memory"); _tail = v; }
+
+    static constexpr uint16_t MAX_CAPACITY = 128;
+#else
+    typedef uint16_t Index;
+
+    std::atomic<Index> _head;
+    std::atomic<Index> _tail;
+
+    inline Index loadHead() const { return _head.load(std::memory_order_acquire); }
+    inline Index loadTail() const { return _tail.load(std::memory_order_acquire); }
+    inline void storeHead(Index v) { _head.store(v, std::memory_order_release); }
+    inline void storeTail(Index v) { _tail.store(v, std::memory_order_release); }
+
+    static constexpr uint16_t MAX_CAPACITY = 32768;
+#endif
+
+    TimedSample *_buf;
+    uint16_t _mask;
+    uint16_t _staged;   // Written but not yet published (writer only)
+    uint16_t _skipped;  // Dropped since the last commit, newer than the staged ones
+    uint32_t _overruns; // Samples dropped on a full ring (writer only)
+
+    static uint16_t floorPow2(uint16_t n)
+    {
+        uint16_t p = 1;
+
+        while (p <= n / 2 && p < MAX_CAPACITY)
+        {
+            p <<= 1;
+        }
+
+        return p;
+    }
+
+public:
+    SampleHistory(TimedSample *buffer, uint16_t capacity)
+        : _head(0), _tail(0), _buf(buffer), _mask(static_cast<uint16_t>(floorPow2(capacity) - 1)), _staged(0), _skipped(0), _overruns(0)
+    {
+    }
+
+    SampleHistory(const SampleHistory &) = delete;
+    SampleHistory &operator=(const SampleHistory &) = delete;
+
+    // Writer: one entry, published immediately
+    inline bool append(uint32_t timeUs, float value)
+    {
+        if (!stage(value))
+        {
+            _skipped = 0;
+            return false;
+        }
+
+        commit(timeUs, 0);
+        return true;
+    }
+
+    // Writer: queue a value without publishing it; false (and an overrun) if full
+    inline bool stage(float value)
+    {
+        const Index head = static_cast<Index>(loadHead() + _staged);
+
+        if (static_cast<Index>(head - loadTail()) > _mask)
+        {
+            _overruns++;
+            _skipped++;
+            return false;
+        }
+
+        _buf[head & _mask].value = value;
+        _staged++;
+        return true;
+    }
+
+    // Writer: publish the staged values, stamped backwards from lastTimeUs
+    // (the newest value of the batch, dropped ones included) in steps of periodUs
+    void commit(uint32_t lastTimeUs, uint32_t periodUs)
+    {
+        const Index head = loadHead();
+        uint32_t t = lastTimeUs - _skipped * periodUs;
+
+        _skipped = 0;
+
+        if (_staged == 0)
+        {
+            return;
+        }
+
+        for (uint16_t i = _staged; i > 0; i--)
+        {
+            _buf[(head + i - 1) & _mask].timeUs = t;
+            t -= periodUs;
+        }
+
+        storeHead(static_cast<Index>(head + _staged));
+        _staged = 0;
+    }
+
+    // Reader: longest contiguous run of unread entries; data stays valid until consume()
+    size_t peek(const TimedSample *&data) const
+    {
+        const Index tail = loadTail();
+        const size_t unread = static_cast<Index>(loadHead() - tail);
+        const size_t toEnd = static_cast<size_t>(_mask) + 1 - (tail & _mask);
+
+        data = _buf + (tail & _mask);
+        return (unread < toEnd) ? unread : toEnd;
+    }
+
+    // Reader: release n entries returned by peek()
+    void consume(size_t n)
+    {
+        const Index tail = loadTail();
+        const size_t unread = static_cast<Index>(loadHead() - tail);
+
+        storeTail(static_cast<Index>(tail + (n < unread ? n : unread)));
+    }
+
+    // Reader: drop everything unread
+    void clear() { storeTail(loadHead()); }
+
+    size_t size() const { return static_cast<Index>(loadHead() - loadTail()); }
+    size_t capacity() const { return static_cast<size_t>(_mask) + 1; }
+
+    uint32_t getOverruns() const { return _overruns; }
+};
+
+// SampleHistory with its own storage; N must be a power of two
+template <uint16_t N>
+class StaticSampleHistory : public SampleHistory
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "StaticSampleHistory size must be a power of two");
+
+private:
+    TimedSample _storage[N];
+
+public:
+    StaticSampleHistory() : SampleHistory(_storage, N) {}
+};
+
+#endif // SAMPLE_HISTORY_H
@@ -0,0 +1,232 @@
+#ifndef SENSOR_BANK_H
+#define SENSOR_BANK_H
+
+#include "BaseMeasurementProcessor.h"
+#include "SensorLock.h"
+#include "StageValueBuffer.h"
+
+/**
+ * N identical channels processed together with structure-of-arrays state.
+ *
+ * Pipeline per channel (each stage optional):
+ *   1. polynomial of a bank-wide degree with per-channel coefficients
+ *   2. one shared mapper over the whole channel vector (e.g. RTD385::applyBlock)
+ *   3. EMA with per-channel alpha
+ *   4. scalar Kalman with per-channel R/Q
+ *
+ * Every stage is a loop over channels on contiguous, 16-byte aligned arrays,
+ * so the compiler can emit 4-8 lanes per instruction (SSE/NEON/Helium/PIE)
+ * from plain C++. One pushAll() takes the lock once for all channels.
+ *
+ * Example usage:
+ *     SensorBank<16> bank;
+ *     RTD385 rtd(100.0f);
+ *     for (uint8_t ch = 0; ch < 16; ch++) { bank.setLinear(ch, gain[ch], offset[ch]); bank.setAlpha(ch, 0.1f); }
+ *     bank.setMapper(&rtd);
+ *     bank.pushAll(adcCounts);      // float[16]
+ *     float T3 = bank.getReading(3);
+ */
+template <uint8_t N, uint8_t MAX_DEGREE = 3>
+class SensorBank
+{
+    static_assert(N > 0, "SensorBank needs at least one channel");
+
+public:
+    typedef StageSnapshot<N> Readings;
+
+private:
+    SensorLock _lock;
+    StageValueBuffer<N> _readings;
+
+    // Stage 1: polynomial, _c[k][ch] is the k-th coefficient of channel ch
+    uint8_t _degree;
+    alignas(16) float _c[MAX_DEGREE + 1][N];
+
+    // Stage 2: shared block mapper
+    BaseMeasurementProcessor *_mapper;
+
+    // Stage 3: EMA
+    bool _emaEnabled;
+    alignas(16) float _alpha[N];
+    alignas(16) float _ema[N];
+
+    // Stage 4: Kalman (random-walk model)
+    bool _kalmanEnabled;
+    alignas(16) float _r[N];
+    alignas(16) float _q[N];
+    alignas(16) float _x[N];
+    alignas(16) float _p[N];
+
+    bool _initialized;
+
+public:
+    explicit SensorBank(PushMode mode = PushMode::LOCKED)
+        : _lock(mode), _degree(1), _mapper(nullptr), _emaEnabled(false), _kalmanEnabled(false), _initialized(false)
+    {
+        for (uint8_t ch = 0; ch < N; ch++)
+        {
+            for (uint8_t k = 0; k <= MAX_DEGREE; k++)
+            {
+                _c[k][ch] = 0.0f;
+            }
+
+            _c[1][ch] = 1.0f; // Default pass through f(x) = 1*x + 0
+
+            _alpha[ch] = 1.0f;
+            _ema[ch] = 0.0f;
+
+            _r[ch] = 1.0f;
+            _q[ch] = 0.0f;
+            _x[ch] = 0.0f;
+            _p[ch] = 1.0f;
+        }
+    }
+
+    ~SensorBank() {}
+
+    SensorBank(const SensorBank &) = delete;
+    SensorBank &operator=(const SensorBank &) = delete;
+
+    static constexpr uint8_t size() { return N; }
+
+    // ---- Configuration (not synchronised with pushAll) ----
+
+    bool setDegree(uint8_t deg)
+    {
+        if (deg > MAX_DEGREE) { return false; }
+        _degree = deg;
+        return true;
+    }
+
+    bool setCoefficient(uint8_t ch, uint8_t idx, float value)
+    {
+        if (ch >= N || idx > MAX_DEGREE) { return false; }
+        _c[idx][ch] = value;
+        return true;
+    }
+
+    // Shortcut for setting f(x) = m*x + b on one channel (bank degree stays as set)
+    void setLinear(uint8_t ch, float m, float b)
+    {
+        setCoefficient(ch, 0, b);
+        setCoefficient(ch, 1, m);
+    }
+
+    // Mapper applied to all channels with one applyBlock() call, nullptr to disable
+    void setMapper(BaseMeasurementProcessor *proc) { _mapper = proc; }
+
+    void enableEMA(bool enable) { _emaEnabled = enable; }
+
+    void setAlpha(uint8_t ch, float a)
+    {
+        if (ch < N)
+        {
+            _alpha[ch] = constrain(a, std::nextafter(0.0f, 1.0f), 1.0f);
+            _emaEnabled = true;
+        }
+    }
+
+    void enableKalman(bool enable) { _kalmanEnabled = enable; }
+
+    void setKalman(uint8_t ch, float r, float q)
+    {
+        if (ch < N)
+        {
+            _r[ch] = r;
+            _q[ch] = q;
+            _kalmanEnabled = true;
+        }
+    }
+
+    // Restart filter state on the next pushAll()
+    void reset() { _initialized = false; }
+
+    // ---- Processing ----
+
+    // samples[ch] for ch in [0, N)
+    void pushAll(const float *samples)
+    {
+        if (!_lock.take())
+        {
+            return;
+        }
+
+        alignas(16) float v[N];
+
+        // Stage 1: Horner, channel loop innermost
+        const uint8_t deg = _degree;
+
+        for (uint8_t ch = 0; ch < N; ch++)
+        {
+            v[ch] = _c[deg][ch];
+        }
+
+        for (int k = deg - 1; k >= 0; k--)
+        {
+            for (uint8_t ch = 0; ch < N; ch++)
+            {
+                v[ch] = v[ch] * samples[ch] + _c[k][ch];
+            }
+        }
+
+        // Stage 2: shared mapper over the channel vector
+        if (_mapper)
+        {
+            _mapper->applyBlock(v, v, N);
+        }
+
+        // Stage 3 + 4: filters, primed with the first sample like the scalar filters
+        if (!_initialized)
+        {
+            for (uint8_t ch = 0; ch < N; ch++)
+            {
+                _ema[ch] = v[ch];
+                _x[ch] = v[ch];
+                _p[ch] = 1.0f;
+            }
+
+            _initialized = true;
+        }
+        else
+        {
+            if (_emaEnabled)
+            {
+                for (uint8_t ch = 0; ch < N; ch++)
+                {
+                    _ema[ch] = _ema[ch] * (1.0f - _alpha[ch]) + v[ch] * _alpha[ch];
+                    v[ch] = _ema[ch];
+                }
+            }
+
+            if (_kalmanEnabled)
+            {
+                for (uint8_t ch = 0; ch < N; ch++)
+                {
+                    float p = _p[ch] + _q[ch];
+                    float k = p / (p + _r[ch]);
+                    _x[ch] += k * (v[ch] - _x[ch]);
+                    _p[ch] = p * (1.0f - k);
+                    v[ch] = _x[ch];
+                }
+            }
+        }
+
+        float *out = _readings.beginWrite();
+
+        for (uint8_t ch = 0; ch < N; ch++)
+        {
+            out[ch] = v[ch];
+        }
+
+        _readings.publish();
+        _lock.give();
+    }
+
+    // ---- Readout (lock-free) ----
+
+    float getReading(uint8_t ch) const { return _readings.read(ch); }
+
+    Readings getReadings() const { return _readings.snapshot(); }
+};
+
+#endif // SENSOR_BANK_H
@@ -0,0 +1,177 @@
+#ifndef SENSOR_FEATURES_H
+#define SENSOR_FEATURES_H
+
+#include "BaseMeasurementProcessor.h"
+#include "ChangeDetector.h"
+#include "ProcessorPool.h"
+#include "SampleHistory.h"
+
+#if !defined(__AVR__)
+#include <atomic>
+#endif
+
+/**
+ * Optional parts of a BasicGenericSensor, selected by its FEATURES mask.
+ * A sensor built without one carries no storage for it: the matching
+ * setters fail or do nothing and the getters return nullptr, so generic
+ * code (SensorSpan, ProcessorFactory) still compiles against it.
+ *
+ *     BasicGenericSensor<1, 0, false, SENSOR_NO_FEATURES>   one stage, nothing else
+ *     BasicGenericSensor<3, 2, true, SENSOR_OWNERSHIP>      pool-owned processors only
+ */
+enum SensorFeature : uint8_t
+{
+    SENSOR_NO_FEATURES  = 0,
+    SENSOR_OWNERSHIP    = 1 << 0, // setAllocator(), emplace(), adoptProcessor()
+    SENSOR_HISTORY      = 1 << 1, // setHistory()
+    SENSOR_CHANGE       = 1 << 2, // setChangeDetector()
+    SENSOR_HOT_SWAP     = 1 << 3, // stagePipeline(), swapComplete(), commitStaged()
+    SENSOR_ALL_FEATURES = 0xFF
+};
+
+// Allocator and owned-slot flags (SENSOR_OWNERSHIP)
+template <uint8_t N, bool ENABLED>
+struct SensorOwnership
+{
+    ProcessorAllocator *_allocator;
+    bool _owned[N];
+
+    SensorOwnership() : _allocator(nullptr)
+    {
+        for (uint8_t i = 0; i < N; i++)
+        {
+            _owned[i] = false;
+        }
+    }
+
+    inline ProcessorAllocator *allocator() const { return _allocator; }
+    inline void setAllocator(ProcessorAllocator *allocator) { _allocator = allocator; }
+    inline bool owned(uint8_t idx) const { return _owned[idx]; }
+    inline void setOwned(uint8_t idx, bool owned) { _owned[idx] = owned; }
+    inline void destroy(BaseMeasurementProcessor *proc) { _allocator->destroy(proc); }
+};
+
+template <uint8_t N>
+struct SensorOwnership<N, false>
+{
+    inline ProcessorAllocator *allocator() const { return nullptr; }
+    inline void setAllocator(ProcessorAllocator *) {}
+    inline bool owned(uint8_t) const { return false; }
+    inline void setOwned(uint8_t, bool) {}
+    inline void destroy(BaseMeasurementProcessor *) {}
+};
+
+// Output history ring and its pushBlock() stamp period (SENSOR_HISTORY)
+template <bool ENABLED>
+struct SensorHistoryLink
+{
+    SampleHistory *_history;
+    uint32_t _periodUs;
+
+    SensorHistoryLink() : _history(nullptr), _periodUs(0) {}
+
+    inline SampleHistory *history() const { return _history; }
+    inline uint32_t periodUs() const { return _periodUs; }
+
+    inline void attach(SampleHistory *history, uint32_t periodUs)
+    {
+        _history = history;
+        _periodUs = periodUs;
+    }
+};
+
+template <>
+struct SensorHistoryLink<false>
+{
+    inline SampleHistory *history() const { return nullptr; }
+    inline uint32_t periodUs() const { return 0; }
+    inline void attach(SampleHistory *, uint32_t) {}
+};
+
+// Report-by-exception test on every output (SENSOR_CHANGE)
+template <bool ENABLED>
+struct SensorChangeLink
+{
+    ChangeDetector *_change;
+
+    SensorChangeLink() : _change(nullptr) {}
+
+    inline ChangeDetector *detector() const { return _change; }
+    inline void attach(ChangeDetector *detector) { _change = detector; }
+};
+
+template <>
+struct SensorChangeLink<false>
+{
+    inline ChangeDetector *detector() const { return nullptr; }
+    inline void attach(ChangeDetector *) {}
+};
+
+/**
+ * Staged pipeline and its hand-over state (SENSOR_HOT_SWAP). One slot array
+ * serves both directions: it holds the staged set until the producer adopts
+ * it, then the owned processors that set replaced until they are destroyed.
+ * State 0 is idle; without the feature the state never leaves it and
+ * claimSwap() always fails.
+ */
+template <uint8_t N, bool ENABLED>
+struct SensorSwapSlots
+{
+    BaseMeasurementProcessor *_slots[N];
+    bool _carry;
+
+#if defined(__AVR__)
+    volatile uint8_t _state;
+
+    inline uint8_t swapState() const { return _state; }
+    inline void setSwapState(uint8_t state) { __asm__ __volatile__("" ::: "memory"); _state = state; }
+
+    bool claimSwap(uint8_t expected, uint8_t desired)
+    {
+        uint8_t sreg = SREG;
+        cli();
+        const bool claimed = (_state == expected);
+        _state = claimed ? desired : _state;
+        SREG = sreg;
+        return claimed;
+    }
+#else
+    std::atomic<uint8_t> _state;
+
+    inline uint8_t swapState() const { return _state.load(std::memory_order_acquire); }
+    inline void setSwapState(uint8_t state) { _state.store(state, std::memory_order_release); }
+
+    bool claimSwap(uint8_t expected, uint8_t desired)
+    {
+        return _state.compare_exchange_strong(expected, desired, std::memory_order_acq_rel);
+    }
+#endif
+
+    SensorSwapSlots() : _carry(false), _state(0)
+    {
+        for (uint8_t i = 0; i < N; i++)
+        {
+            _slots[i] = nullptr;
+        }
+    }
+
+    inline BaseMeasurementProcessor *slot(uint8_t idx) const { return _slots[idx]; }
+    inline void setSlot(uint8_t idx, BaseMeasurementProcessor *proc) { _slots[idx] = proc; }
+    inline bool carry() const { return _carry; }
+    inline void setCarry(bool carry) { _carry = carry; }
+};
+
+template <uint8_t N>
+struct SensorSwapSlots<N, false>
+{
+    inline uint8_t swapState() const { return 0; }
+    inline void setSwapState(uint8_t) {}
+    inline bool claimSwap(uint8_t, uint8_t) { return false; }
+
+    inline BaseMeasurementProcessor *slot(uint8_t) const { return nullptr; }
+    inline void setSlot(uint8_t, BaseMeasurementProcessor *) {}
+    inline bool carry() const { return false; }
+    inline void setCarry(bool) {}
+};
+
+#endif // SENSOR_FEATURES_H
@@ -0,0 +1,223 @@
+#ifndef SENSOR_GRAPH_H
+#define SENSOR_GRAPH_H
+
+#include <Arduino.h>
+#include "SensorSpan.h"
+
+/**
+ * Dependencies between the sensors of a span: link(from, to, channel)
+ * feeds the output of sensor from to side input channel of the stages of
+ * sensor to (e.g. a cold-junction RTD into ThermocoupleTypeK).
+ *
+ * update() pushes one sample per sensor in topological order, so every
+ * upstream output is current before its consumers run, and hands each
+ * sensor its side inputs together with its sample: one lock acquisition
+ * per sensor and pass, no extra getReading() / push() round trip per
+ * dependency. Upstream outputs are taken with the lock-free getReading().
+ *
+ * The order is computed once by build() (Kahn's algorithm, ties by span
+ * index) and kept until the links change; a cycle makes build() and
+ * update() fail. update() is the only producer of the sensors, so they can
+ * run in PushMode::SINGLE_PRODUCER.
+ *
+ * Example usage (32 type K channels compensated by one Pt100 on the board):
+ *     static GenericSensor sensors[33];      // 0 … 31 thermocouples, 32 the CJ RTD
+ *     static SensorGraph graph(SensorSpan(sensors, 33));
+ *     ...
+ *     for (uint8_t ch = 0; ch < 32; ch++) { graph.link(32, ch, ThermocoupleTypeK::SIDE_COLD_JUNCTION); }
+ *     ...
+ *     float scan[33];                        // mV × 32, Ω
+ *     graph.update(scan);
+ */
+template <class Sensor, uint8_t MAX_SENSORS = 64, uint8_t MAX_LINKS = 64>
+class BasicSensorGraph
+{
+public:
+    static constexpr uint8_t MAX_SIDE_INPUTS = 8; // Links into one sensor
+
+private:
+    struct Link
+    {
+        uint8_t from;
+        uint8_t to;
+        uint8_t channel;
+    };
+
+    BasicSensorSpan<Sensor> _sensors;
+    uint8_t _count;
+
+    Link _links[MAX_LINKS]; // Sorted by target after build()
+    uint8_t _numLinks;
+
+    uint8_t _order[MAX_SENSORS];     // Sensor indices, upstream first
+    uint8_t _first[MAX_SENSORS + 1]; // Links into sensor s: _first[s] … _first[s + 1] - 1
+    bool _built;
+
+    float _outputs[MAX_SENSORS]; // getReading() of each sensor after its last update
+
+public:
+    explicit BasicSensorGraph(BasicSensorSpan<Sensor> sensors)
+        : _sensors(sensors),
+          _count(static_cast<uint8_t>(sensors.size() < MAX_SENSORS ? sensors.size() : MAX_SENSORS)),
+          _numLinks(0),
+          _built(false)
+    {
+        for (uint8_t i = 0; i < MAX_SENSORS; i++)
+        {
+            _outputs[i] = 0.0f;
+        }
+    }
+
+    // Output of from → side input channel of to. False if an index is out
+    // of range, from == to, the link table is full or to already has
+    // MAX_SIDE_INPUTS links.
+    bool link(uint8_t from, uint8_t to, uint8_t channel = 0)
+    {
+        if (from >= _count || to >= _count || from == to || _numLinks >= MAX_LINKS)
+        {
+            return false;
+        }
+
+        uint8_t into = 0;
+
+        for (uint8_t k = 0; k < _numLinks; k++)
+        {
+            into += (_links[k].to == to) ? 1 : 0;
+        }
+
+        if (into >= MAX_SIDE_INPUTS)
+        {
+            return false;
+        }
+
+        _links[_numLinks].from = from;
+        _links[_numLinks].to = to;
+        _links[_numLinks].channel = channel;
+        _numLinks++;
+        _built = false;
+        return true;
+    }
+
+    void clearLinks()
+    {
+        _numLinks = 0;
+        _built = false;
+    }
+
+    // Topological order of the sensors; false if the links form a cycle
+    bool build()
+    {
+        // Group the links by target (insertion sort keeps the link order per target)
+        for (uint8_t k = 1; k < _numLinks; k++)
+        {
+            const Link l = _links[k];
+            uint8_t j = k;
+
+            while (j > 0 && _links[j - 1].to > l.to)
+            {
+                _links[j] = _links[j - 1];
+                j--;
+            }
+
+            _links[j] = l;
+        }
+
+        uint8_t pending[MAX_SENSORS]; // Unplaced upstream sensors per sensor
+        bool placed[MAX_SENSORS];
+
+        uint8_t end = 0;
+
+        for (uint16_t s = 0; s <= _count; s++)
+        {
+            _first[s] = end;
+
+            if (s < _count)
+            {
+                while (end < _numLinks && _links[end].to == s)
+                {
+                    end++;
+                }
+
+                pending[s] = end - _first[s];
+                placed[s] = false;
+            }
+        }
+
+        // Kahn's algorithm: repeatedly place the lowest-index sensor with no unplaced upstream
+        for (uint8_t n = 0; n < _count; n++)
+        {
+            uint8_t next = _count;
+
+            for (uint8_t s = 0; s < _count && next == _count; s++)
+            {
+                next = (!placed[s] && pending[s] == 0) ? s : next;
+            }
+
+            if (next == _count)
+            {
+                _built = false;
+                return false;
+            }
+
+            placed[next] = true;
+            _order[n] = next;
+
+            for (uint8_t k = 0; k < _numLinks; k++)
+            {
+                if (_links[k].from == next)
+                {
+                    pending[_links[k].to]--;
+                }
+            }
+        }
+
+        _built = true;
+        return true;
+    }
+
+    /**
+     * One pass over all sensors: samples[i] is pushed into sensor i, after
+     * the outputs of its upstream sensors from this same pass were handed to
+     * it as side inputs. Returns false (nothing pushed) on a cyclic graph.
+     */
+    bool update(const float *samples)
+    {
+        if (!_built && !build())
+        {
+            return false;
+        }
+
+        for (uint8_t n = 0; n < _count; n++)
+        {
+            const uint8_t s = _order[n];
+            SideInput inputs[MAX_SIDE_INPUTS];
+            uint8_t count = 0;
+
+            for (uint8_t k = _first[s]; k < _first[s + 1]; k++)
+            {
+                inputs[count].channel = _links[k].channel;
+                inputs[count].value = _outputs[_links[k].from];
+                count++;
+            }
+
+            _sensors[s].push(samples[s], inputs, count);
+            _outputs[s] = _sensors[s].getReading();
+        }
+
+        return true;
+    }
+
+    // Output of sensor i after the last update()
+    float getOutput(uint8_t i) const { return i < _count ? _outputs[i] : 0.0f; }
+
+    // Sensor index at position n of the evaluation order (after build())
+    uint8_t getOrder(uint8_t n) const { return n < _count ? _order[n] : 0; }
+
+    bool isBuilt() const { return _built; }
+    uint8_t size() const { return _count; }
+    uint8_t getLinkCount() const { return _numLinks; }
+};
+
+typedef BasicSensorGraph<GenericSensor> SensorGraph;
+
+#endif // SENSOR_GRAPH_H
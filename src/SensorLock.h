@@ -0,0 +1,86 @@
+#ifndef SENSOR_LOCK_H
+#define SENSOR_LOCK_H
+
+#include <Arduino.h>
+
+// FreeRTOS mutex on ESP32 (always available) or with GENERIC_SENSOR_USE_FREERTOS
+// (e.g. STM32FreeRTOS); bare-metal targets (AVR, Cortex-M0+) have a single
+// thread of execution and get a no-op lock.
+#if defined(ESP32)
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#define SENSOR_LOCK_FREERTOS 1
+#elif defined(GENERIC_SENSOR_USE_FREERTOS)
+#include <FreeRTOS.h>
+#include <semphr.h>
+#define SENSOR_LOCK_FREERTOS 1
+#endif
+
+// Producer-side synchronisation of a sensor pipeline.
+enum class PushMode : uint8_t
+{
+    LOCKED = 0,     // push() takes a FreeRTOS mutex; any number of producer tasks
+    SINGLE_PRODUCER // no mutex; exactly one task may push() / reconfigure the sensor
+};
+
+// Optional FreeRTOS mutex guarding processor state. In SINGLE_PRODUCER mode
+// no semaphore is created and take()/give() compile down to a null check.
+#if defined(SENSOR_LOCK_FREERTOS)
+class SensorLock
+{
+private:
+    SemaphoreHandle_t _lock;
+
+public:
+    explicit SensorLock(PushMode mode = PushMode::LOCKED)
+        : _lock((mode == PushMode::LOCKED) ? xSemaphoreCreateMutex() : nullptr)
+    {
+    }
+
+    ~SensorLock()
+    {
+        if (_lock)
+        {
+            vSemaphoreDelete(_lock);
+        }
+    }
+
+    SensorLock(const SensorLock &) = delete;
+    SensorLock &operator=(const SensorLock &) = delete;
+
+    inline bool take()
+    {
+        return (_lock == nullptr) || (xSemaphoreTake(_lock, portMAX_DELAY) == pdTRUE);
+    }
+
+    inline void give()
+    {
+        if (_lock)
+        {
+            xSemaphoreGive(_lock);
+        }
+    }
+
+    PushMode mode() const { return _lock ? PushMode::LOCKED : PushMode::SINGLE_PRODUCER; }
+};
+#else
+// No RTOS: nothing can preempt a push() except interrupts, which must not push
+class SensorLock
+{
+private:
+    PushMode _mode;
+
+public:
+    explicit SensorLock(PushMode mode = PushMode::LOCKED) : _mode(mode) {}
+
+    SensorLock(const SensorLock &) = delete;
+    SensorLock &operator=(const SensorLock &) = delete;
+
+    inline bool take() { return true; }
+    inline void give() {}
+
+    PushMode mode() const { return _mode; }
+};
+#endif
+
+#endif // SENSOR_LOCK_H
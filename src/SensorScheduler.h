@@ -0,0 +1,344 @@
+#ifndef SENSOR_SCHEDULER_H
+#define SENSOR_SCHEDULER_H
+
+#include <Arduino.h>
+#include "SensorSpan.h"
+#include "SpscRing.h"
+
+#if defined(ESP32)
+#include "freertos/task.h"
+#elif defined(GENERIC_SENSOR_USE_FREERTOS)
+#include <task.h>
+#endif
+
+// Returns the raw sample of one channel (ADC counts, volts, ...); called from the sampler
+typedef float (*SampleReader)(uint8_t channel, void *context);
+
+/**
+ * Split acquisition from processing for the sensors of a span.
+ *
+ * A sampler reads every channel at its own rate through a SampleReader
+ * callback and pushes the raw value into a lock-free SpscRing per channel;
+ * a processor drains the rings and runs the pipelines with pushBlock(), so
+ * the expensive stages run in batches, off the sampling path. On ESP32,
+ * begin() pins the sampler to core 0 and the processor to core 1; with
+ * GENERIC_SENSOR_USE_FREERTOS both are plain tasks. Without an RTOS (or
+ * for a custom loop) call sample() and process() directly.
+ *
+ * Sampling instants are kept on a fixed grid per channel. A sampler that
+ * wakes one or more whole periods late skips the lost instants instead of
+ * bursting them and counts them in getMissed(); samples lost to a full ring
+ * (processor too slow) are counted in getDropped().
+ *
+ * The processor task is the only producer of the sensors, so they can run
+ * in PushMode::SINGLE_PRODUCER. Configure the channels before begin().
+ *
+ * Channels faster than the RTOS tick are served by spinning; the sampler
+ * still blocks for one tick every YIELD_INTERVAL_US so the idle task (and
+ * its watchdog) on that core gets to run, which shows up as missed samples
+ * on such channels. Longer waits are also split at YIELD_INTERVAL_US and
+ * cut short by stop(), so stop() returns promptly with slow or disabled
+ * channels.
+ *
+ * Example usage (ESP32, 8 channels):
+ *     static GenericSensor sensors[8];
+ *     static SensorScheduler scheduler(SensorSpan(sensors, 8));
+ *     float readAdc(uint8_t ch, void *) { return analogRead(PINS[ch]); }
+ *     ...
+ *     for (uint8_t ch = 0; ch < 8; ch++) { scheduler.setChannel(ch, readAdc, ch < 2 ? 1000.0f : 50.0f); }
+ *     scheduler.begin();
+ */
+template <class Sensor, uint8_t MAX_CHANNELS = 16, uint16_t RING_SIZE = 64>
+class BasicSensorScheduler
+{
+public:
+    static constexpr uint32_t YIELD_INTERVAL_US = 100000;
+    static constexpr uint16_t BLOCK_SIZE = (RING_SIZE < 32) ? RING_SIZE : 32; // Samples per pushBlock() call
+
+private:
+    struct Channel
+    {
+        SampleReader reader;
+        void *context;
+        uint32_t periodUs; // 0: channel disabled
+        uint32_t nextUs;   // Next sampling instant
+        uint32_t missed;   // Skipped sampling instants (sampler)
+        uint32_t processed;
+        SpscRing<float, RING_SIZE> ring;
+
+        Channel() : reader(nullptr), context(nullptr), periodUs(0), nextUs(0), missed(0), processed(0) {}
+    };
+
+    BasicSensorSpan<Sensor> _sensors;
+    Channel _channels[MAX_CHANNELS];
+    uint8_t _count;
+    uint16_t _batch;     // Ring fill that wakes the processor
+    uint32_t _latencyMs; // Longest the processor sleeps with pending samples
+
+#if defined(SENSOR_LOCK_FREERTOS)
+    volatile TaskHandle_t _samplerTask;
+    volatile TaskHandle_t _processorTask;
+#endif
+    volatile bool _running;
+
+    inline void wakeProcessor()
+    {
+#if defined(SENSOR_LOCK_FREERTOS)
+        if (_processorTask)
+        {
+            xTaskNotifyGive(_processorTask);
+        }
+#endif
+    }
+
+#if defined(SENSOR_LOCK_FREERTOS)
+    static void samplerLoop(void *arg)
+    {
+        BasicSensorScheduler *self = static_cast<BasicSensorScheduler *>(arg);
+        const uint32_t tickUs = portTICK_PERIOD_MS * 1000UL;
+        uint32_t lastBlock = micros();
+
+        while (self->_running)
+        {
+            const uint32_t now = micros();
+            uint32_t wait = self->sample(now);
+
+            if (wait >= tickUs)
+            {
+                // Capped, and stop() notifies: slow or disabled channels do not hold up stop()
+                wait = (wait < YIELD_INTERVAL_US) ? wait : YIELD_INTERVAL_US;
+                ulTaskNotifyTake(pdTRUE, wait / tickUs);
+                lastBlock = micros();
+            }
+            else if (now - lastBlock >= YIELD_INTERVAL_US)
+            {
+                vTaskDelay(1);
+                lastBlock = micros();
+            }
+        }
+
+        self->_samplerTask = nullptr;
+        vTaskDelete(nullptr);
+    }
+
+    static void processorLoop(void *arg)
+    {
+        BasicSensorScheduler *self = static_cast<BasicSensorScheduler *>(arg);
+
+        while (self->_running)
+        {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(self->_latencyMs));
+            self->process();
+        }
+
+        self->process();
+        self->_processorTask = nullptr;
+        vTaskDelete(nullptr);
+    }
+#endif
+
+public:
+    explicit BasicSensorScheduler(BasicSensorSpan<Sensor> sensors)
+        : _sensors(sensors),
+          _count(static_cast<uint8_t>(sensors.size() < MAX_CHANNELS ? sensors.size() : MAX_CHANNELS)),
+          _batch(RING_SIZE / 2),
+          _latencyMs(10),
+#if defined(SENSOR_LOCK_FREERTOS)
+          _samplerTask(nullptr),
+          _processorTask(nullptr),
+#endif
+          _running(false)
+    {
+    }
+
+    ~BasicSensorScheduler() { stop(); }
+
+    BasicSensorScheduler(const BasicSensorScheduler &) = delete;
+    BasicSensorScheduler &operator=(const BasicSensorScheduler &) = delete;
+
+    // Sample sensor ch at rateHz through reader (rateHz = 0 disables it).
+    // False if ch is outside the span (or beyond MAX_CHANNELS) or while running.
+    bool setChannel(uint8_t ch, SampleReader reader, float rateHz, void *context = nullptr)
+    {
+        if (ch >= _count || _running || (reader == nullptr && rateHz > 0.0f))
+        {
+            return false;
+        }
+
+        Channel &c = _channels[ch];
+        c.reader = reader;
+        c.context = context;
+        c.periodUs = (rateHz > 0.0f) ? static_cast<uint32_t>(1e6f / rateHz + 0.5f) : 0;
+
+        if (rateHz > 0.0f && c.periodUs == 0)
+        {
+            c.periodUs = 1;
+        }
+
+        c.nextUs = micros();
+        return true;
+    }
+
+    // Ring fill (samples) that wakes the processor, and the longest it waits otherwise
+    void setBatching(uint16_t samples, uint32_t maxLatencyMs)
+    {
+        _batch = (samples == 0) ? 1 : (samples > RING_SIZE ? RING_SIZE : samples);
+        _latencyMs = (maxLatencyMs == 0) ? 1 : maxLatencyMs;
+    }
+
+    /**
+     * Sampler step: reads every channel that is due at nowUs, queues the
+     * values and returns the µs until the next channel is due.
+     */
+    uint32_t sample(uint32_t nowUs)
+    {
+        uint32_t wait = 0xFFFFFFFFUL;
+        bool wake = false;
+
+        for (uint8_t ch = 0; ch < _count; ch++)
+        {
+            Channel &c = _channels[ch];
+
+            if (c.periodUs == 0)
+            {
+                continue;
+            }
+
+            const int32_t late = static_cast<int32_t>(nowUs - c.nextUs);
+
+            if (late >= 0)
+            {
+                c.ring.push(c.reader(ch, c.context));
+
+                if (static_cast<uint32_t>(late) >= c.periodUs)
+                {
+                    const uint32_t skipped = static_cast<uint32_t>(late) / c.periodUs;
+                    c.missed += skipped;
+                    c.nextUs += skipped * c.periodUs;
+                }
+
+                c.nextUs += c.periodUs;
+                wake = wake || (c.ring.size() >= _batch);
+            }
+
+            const uint32_t left = c.nextUs - nowUs;
+            wait = (left < wait) ? left : wait;
+        }
+
+        if (wake)
+        {
+            wakeProcessor();
+        }
+
+        return wait;
+    }
+
+    // Processor step: runs every queued sample through its sensor; returns the count
+    size_t process()
+    {
+        float block[BLOCK_SIZE];
+        size_t total = 0;
+
+        for (uint8_t ch = 0; ch < _count; ch++)
+        {
+            Channel &c = _channels[ch];
+            size_t budget = RING_SIZE; // Bounded even if the sampler keeps up
+            size_t n;
+
+            while (budget > 0 && (n = c.ring.popBlock(block, budget < BLOCK_SIZE ? budget : BLOCK_SIZE)) > 0)
+            {
+                _sensors[ch].pushBlock(block, n);
+                c.processed += n;
+                total += n;
+                budget -= n;
+            }
+        }
+
+        return total;
+    }
+
+#if defined(SENSOR_LOCK_FREERTOS)
+    // Start the sampler and processor tasks (cores are ignored without ESP32)
+    bool begin(uint8_t samplerCore = 0, uint8_t processorCore = 1, UBaseType_t priority = 5, uint32_t stackSize = 4096)
+    {
+        if (_running)
+        {
+            return false;
+        }
+
+        const uint32_t now = micros();
+
+        for (uint8_t ch = 0; ch < _count; ch++)
+        {
+            _channels[ch].nextUs = now;
+        }
+
+        _running = true;
+
+        TaskHandle_t sampler = nullptr;
+        TaskHandle_t processor = nullptr;
+
+#if defined(ESP32)
+        BaseType_t ok = xTaskCreatePinnedToCore(processorLoop, "sensProc", stackSize, this, priority, &processor, processorCore);
+#else
+        (void)samplerCore;
+        (void)processorCore;
+        BaseType_t ok = xTaskCreate(processorLoop, "sensProc", stackSize, this, priority, &processor);
+#endif
+        _processorTask = processor;
+
+        if (ok == pdPASS)
+        {
+#if defined(ESP32)
+            ok = xTaskCreatePinnedToCore(samplerLoop, "sensSmpl", stackSize, this, priority + 1, &sampler, samplerCore);
+#else
+            ok = xTaskCreate(samplerLoop, "sensSmpl", stackSize, this, priority + 1, &sampler);
+#endif
+            _samplerTask = sampler;
+        }
+
+        if (ok != pdPASS)
+        {
+            stop();
+            return false;
+        }
+
+        return true;
+    }
+
+    // Ask both tasks to finish (the processor drains the rings) and wait for them
+    void stop()
+    {
+        _running = false;
+        wakeProcessor();
+
+        if (_samplerTask)
+        {
+            xTaskNotifyGive(_samplerTask);
+        }
+
+        while (_samplerTask || _processorTask)
+        {
+            vTaskDelay(1);
+        }
+    }
+#else
+    void stop() {}
+#endif
+
+    bool isRunning() const { return _running; }
+    uint8_t size() const { return _count; }
+
+    // Sampling instants skipped because the sampler ran late
+    uint32_t getMissed(uint8_t ch) const { return ch < _count ? _channels[ch].missed : 0; }
+
+    // Samples lost to a full ring because the processor fell behind
+    uint32_t getDropped(uint8_t ch) const { return ch < _count ? _channels[ch].ring.dropped() : 0; }
+
+    uint32_t getProcessed(uint8_t ch) const { return ch < _count ? _channels[ch].processed : 0; }
+    size_t getPending(uint8_t ch) const { return ch < _count ? _channels[ch].ring.size() : 0; }
+};
+
+typedef BasicSensorScheduler<GenericSensor> SensorScheduler;
+
+#endif // SENSOR_SCHEDULER_H
@@ -4,26 +4,53 @@
 #include <Arduino.h>
 #include "GenericSensor.h"
 
-class SensorSpan {
+template <class Sensor>
+class BasicSensorSpan {
 public:
-  SensorSpan() : _ptr(nullptr), _n(0) {}
-  SensorSpan(GenericSensor* ptr, size_t n) : _ptr(ptr), _n(n) {}
+  BasicSensorSpan() : _ptr(nullptr), _n(0) {}
+  BasicSensorSpan(Sensor* ptr, size_t n) : _ptr(ptr), _n(n) {}
 
   size_t size() const { return _n; }
   bool empty() const  { return _n == 0; }
 
-  GenericSensor& operator[](size_t i)       { return _ptr[i]; }
-  const GenericSensor& operator[](size_t i) const { return _ptr[i]; }
-
-  GenericSensor& at(size_t i)       { return _ptr[i]; }
-  const GenericSensor& at(size_t i) const { return _ptr[i]; }
-
-  GenericSensor* data()       { return _ptr; }
-  const GenericSensor* data() const { return _ptr; }
+  Sensor& operator[](size_t i)       { return _ptr[i]; }
+  const Sensor& operator[](size_t i) const { return _ptr[i]; }
+
+  Sensor& at(size_t i)       { return _ptr[i]; }
+  const Sensor& at(size_t i) const { return _ptr[i]; }
+
+  Sensor* data()       { return _ptr; }
+  const Sensor* data() const { return _ptr; }
+
+  // Same allocator for every sensor in the span; false if any still owns processors
+  bool setAllocator(ProcessorAllocator* allocator) {
+    bool ok = true;
+    for (size_t i = 0; i < _n; i++) { ok = _ptr[i].setAllocator(allocator) && ok; }
+    return ok;
+  }
+
+  // Bit i set if sensor i reported a change since the last poll (first 64
+  // sensors, those with a ChangeDetector); clears the flags it returns
+  uint64_t pollChanged() {
+    uint64_t mask = 0;
+    const size_t n = (_n < 64) ? _n : 64;
+    for (size_t i = 0; i < n; i++) {
+      ChangeDetector* change = _ptr[i].getChangeDetector();
+      if (change && change->consumeChanged()) { mask |= (uint64_t)1 << i; }
+    }
+    return mask;
+  }
+
+  // Empty all sensors, returning owned processors to their allocator
+  void clearProcessors() {
+    for (size_t i = 0; i < _n; i++) { _ptr[i].clearProcessors(); }
+  }
 
 private:
-  GenericSensor* _ptr;
+  Sensor* _ptr;
   size_t _n;
 };
 
+typedef BasicSensorSpan<GenericSensor> SensorSpan;
+
 #endif // SENSOR_SPAN_H
\ No newline at end of file
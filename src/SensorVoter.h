@@ -0,0 +1,250 @@
+#ifndef SENSOR_VOTER_H
+#define SENSOR_VOTER_H
+
+#include <Arduino.h>
+#include "SensorSpan.h"
+
+// Fusion rule of a SensorVoter
+enum class VoteMode : uint8_t
+{
+    MEDIAN,
+    TRIMMED_MEAN,
+    INVERSE_VARIANCE
+};
+
+/**
+ * Fuses redundant sensors of a span (e.g. three RTDs on one process point)
+ * into one value.
+ *
+ * Members are span indices added with addMember(). Each vote takes their
+ * getReading() (lock-free) and:
+ *   1. rejects NaN readings and, with setOutlierLimit(limit), readings
+ *      more than limit away from the median of all non-NaN readings, the
+ *      member's own included (only with three or more left, two cannot
+ *      outvote each other); rejected members are flagged in
+ *      getOutlierMask() (bit i = member i),
+ *   2. fuses the remaining ones:
+ *      MEDIAN            middle value (mean of the two middle ones if even)
+ *      TRIMMED_MEAN      mean after dropping setTrim(k) lowest and highest
+ *      INVERSE_VARIANCE  Σ(xᵢ/σᵢ²) / Σ(1/σᵢ²), σᵢ² from the member's
+ *                        getErrorVariance() (its Kalman stage); members
+ *                        without one use setDefaultVariance()
+ *   3. fails (isValid() false, previous value kept) if fewer than
+ *      setQuorum() members remain, e.g. 2 for 2-out-of-3.
+ *
+ * update(samples) pushes one sample into every member and votes right
+ * after, so the fused value comes out of the same pass as the pipelines;
+ * vote() alone fuses after another pass (SensorGraph::update(),
+ * SensorScheduler::process()) on the same task.
+ *
+ * Example usage (2-out-of-3 RTDs, 0.5 °C disagreement limit):
+ *     static GenericSensor rtds[3];
+ *     SensorVoter voter(SensorSpan(rtds, 3), VoteMode::MEDIAN);
+ *     for (uint8_t i = 0; i < 3; i++) { voter.addMember(i); }
+ *     voter.setOutlierLimit(0.5f);
+ *     voter.setQuorum(2);
+ *     ...
+ *     float ohms[3] = {...};
+ *     if (voter.update(ohms)) { control(voter.getValue()); }
+ *     if (voter.getOutlierMask()) { raiseMaintenanceAlarm(); }
+ */
+template <class Sensor, uint8_t MAX_MEMBERS = 8>
+class BasicSensorVoter
+{
+    static_assert(MAX_MEMBERS >= 1 && MAX_MEMBERS <= 32, "BasicSensorVoter supports 1 ... 32 members");
+
+private:
+    BasicSensorSpan<Sensor> _sensors;
+    VoteMode _mode;
+
+    uint8_t _members[MAX_MEMBERS]; // Span indices
+    uint8_t _count;
+
+    float _limit;       // Max distance from the median, 0: off
+    uint8_t _trim;      // Values dropped at each end in TRIMMED_MEAN
+    uint8_t _quorum;    // Minimum accepted members
+    float _defaultVar;  // For members without getErrorVariance()
+
+    float _value;
+    uint32_t _outliers; // Rejected members of the last vote
+    uint8_t _valid;     // Accepted members of the last vote
+    bool _ok;
+
+    // Ascending sort of n ≤ MAX_MEMBERS values, carrying the member index
+    static void sort(float *x, uint8_t *idx, uint8_t n)
+    {
+        for (uint8_t k = 1; k < n; k++)
+        {
+            const float v = x[k];
+            const uint8_t i = idx[k];
+            uint8_t j = k;
+
+            while (j > 0 && x[j - 1] > v)
+            {
+                x[j] = x[j - 1];
+                idx[j] = idx[j - 1];
+                j--;
+            }
+
+            x[j] = v;
+            idx[j] = i;
+        }
+    }
+
+    static inline float median(const float *sorted, uint8_t n)
+    {
+        return (n & 1) ? sorted[n / 2] : 0.5f * (sorted[n / 2 - 1] + sorted[n / 2]);
+    }
+
+public:
+    explicit BasicSensorVoter(BasicSensorSpan<Sensor> sensors, VoteMode mode = VoteMode::MEDIAN)
+        : _sensors(sensors), _mode(mode), _count(0), _limit(0.0f), _trim(1), _quorum(1), _defaultVar(1.0f),
+          _value(NAN), _outliers(0), _valid(0), _ok(false)
+    {
+    }
+
+    // Span index of the next member; false if out of range or full
+    bool addMember(uint8_t index)
+    {
+        if (index >= _sensors.size() || _count >= MAX_MEMBERS)
+        {
+            return false;
+        }
+
+        _members[_count++] = index;
+        return true;
+    }
+
+    void clearMembers() { _count = 0; }
+
+    void setMode(VoteMode mode) { _mode = mode; }
+    void setOutlierLimit(float limit) { _limit = limit; }
+    void setTrim(uint8_t k) { _trim = k; }
+    void setQuorum(uint8_t n) { _quorum = (n == 0) ? 1 : n; }
+    void setDefaultVariance(float variance) { _defaultVar = (variance > 0.0f) ? variance : 1.0f; }
+
+    // Push samples[i] into member i, then vote
+    bool update(const float *samples)
+    {
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            _sensors[_members[i]].push(samples[i]);
+        }
+
+        return vote();
+    }
+
+    // Fuse the members' current readings; false if the quorum is not met
+    bool vote()
+    {
+        float x[MAX_MEMBERS];
+        uint8_t idx[MAX_MEMBERS];
+        uint8_t n = 0;
+        uint32_t rejected = 0;
+
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            const float v = _sensors[_members[i]].getReading();
+
+            if (v == v)
+            {
+                x[n] = v;
+                idx[n] = i;
+                n++;
+            }
+            else
+            {
+                rejected |= 1UL << i;
+            }
+        }
+
+        sort(x, idx, n);
+
+        // Distance test against the median of everything that read a number
+        if (_limit > 0.0f && n > 2)
+        {
+            const float mid = median(x, n);
+            uint8_t kept = 0;
+
+            for (uint8_t k = 0; k < n; k++)
+            {
+                if (fabsf(x[k] - mid) <= _limit)
+                {
+                    x[kept] = x[k];
+                    idx[kept] = idx[k];
+                    kept++;
+                }
+                else
+                {
+                    rejected |= 1UL << idx[k];
+                }
+            }
+
+            n = kept;
+        }
+
+        _outliers = rejected;
+        _valid = n;
+        _ok = (n >= _quorum);
+
+        if (!_ok)
+        {
+            return false;
+        }
+
+        if (_mode == VoteMode::TRIMMED_MEAN)
+        {
+            const uint8_t trim = (n > 2 * _trim) ? _trim : (n - 1) / 2;
+            float sum = 0.0f;
+
+            for (uint8_t k = trim; k < n - trim; k++)
+            {
+                sum += x[k];
+            }
+
+            _value = sum / static_cast<float>(n - 2 * trim);
+        }
+        else if (_mode == VoteMode::INVERSE_VARIANCE)
+        {
+            float num = 0.0f;
+            float den = 0.0f;
+
+            for (uint8_t k = 0; k < n; k++)
+            {
+                float var;
+
+                if (!_sensors[_members[idx[k]]].getErrorVariance(var) || !(var > 0.0f))
+                {
+                    var = _defaultVar;
+                }
+
+                num += x[k] / var;
+                den += 1.0f / var;
+            }
+
+            _value = num / den;
+        }
+        else
+        {
+            _value = median(x, n);
+        }
+
+        return true;
+    }
+
+    // Fused value of the last successful vote (NaN before the first)
+    float getValue() const { return _value; }
+
+    // Last vote met the quorum
+    bool isValid() const { return _ok; }
+
+    // Bit i: member i was rejected (NaN or outlier) in the last vote
+    uint32_t getOutlierMask() const { return _outliers; }
+
+    uint8_t getValidCount() const { return _valid; }
+    uint8_t size() const { return _count; }
+};
+
+typedef BasicSensorVoter<GenericSensor> SensorVoter;
+
+#endif // SENSOR_VOTER_H
@@ -0,0 +1,129 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <Arduino.h>
+
+#if !defined(__AVR__)
+#include <atomic>
+#endif
+
+/**
+ * Lock-free single-producer / single-consumer ring of N elements (N a power
+ * of two) in static storage.
+ *
+ * Head and tail are free-running counters, each written by one side only;
+ * the producer publishes an element with a release store of the head, the
+ * consumer frees it with a release store of the tail. No element is ever
+ * overwritten: push() on a full ring fails and counts the loss in
+ * dropped(). Safe across cores (ESP32) and between an ISR and a task.
+ *
+ * AVR has no <atomic>; there the indices are single bytes (N ≤ 128) so
+ * plain volatile loads and stores are atomic.
+ *
+ * Example usage:
+ *     SpscRing<float, 64> ring;
+ *     ring.push(sample);                       // producer (ISR / sampler task)
+ *     float block[32];
+ *     size_t n = ring.popBlock(block, 32);     // consumer
+ */
+template <typename T, uint16_t N>
+class SpscRing
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+private:
+    static constexpr uint16_t MASK = N - 1;
+
+    T _buf[N];
+
+#if defined(__AVR__)
+    static_assert(N <= 128, "SpscRing on AVR holds at most 128 elements");
+    typedef uint8_t Index;
+
+    volatile Index _head; // Next slot to write (producer)
+    volatile Index _tail; // Next slot to read (consumer)
+
+    inline Index loadHead() const { __asm__ __volatile__("" ::: "memory"); return _head; }
+    inline Index loadTail() const { __asm__ __volatile__("" ::: "memory"); return _tail; }
+    inline void storeHead(Index v) { __asm__ __volatile__("" ::: "memory"); _head = v; }
+    inline void storeTail(Index v) { __asm__ __volatile__("" ::: "memory"); _tail = v; }
+#else
+    typedef uint16_t Index;
+
+    std::atomic<Index> _head;
+    std::atomic<Index> _tail;
+
+    inline Index loadHead() const { return _head.load(std::memory_order_acquire); }
+    inline Index loadTail() const { return _tail.load(std::memory_order_acquire); }
+    inline void storeHead(Index v) { _head.store(v, std::memory_order_release); }
+    inline void storeTail(Index v) { _tail.store(v, std::memory_order_release); }
+#endif
+
+    uint32_t _dropped; // Written by the producer only
+
+public:
+    SpscRing() : _head(0), _tail(0), _dropped(0) {}
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    // Producer: false (and dropped() + 1) if the ring is full
+    inline bool push(const T &value)
+    {
+        const Index head = loadHead();
+
+        if (static_cast<Index>(head - loadTail()) >= N)
+        {
+            _dropped++;
+            return false;
+        }
+
+        _buf[head & MASK] = value;
+        storeHead(static_cast<Index>(head + 1));
+        return true;
+    }
+
+    // Consumer: false if the ring is empty
+    inline bool pop(T &value)
+    {
+        const Index tail = loadTail();
+
+        if (tail == loadHead())
+        {
+            return false;
+        }
+
+        value = _buf[tail & MASK];
+        storeTail(static_cast<Index>(tail + 1));
+        return true;
+    }
+
+    // Consumer: move up to max elements into out, one tail update; returns the count
+    size_t popBlock(T *out, size_t max)
+    {
+        const Index tail = loadTail();
+        size_t n = static_cast<Index>(loadHead() - tail);
+
+        if (n > max)
+        {
+            n = max;
+        }
+
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = _buf[(tail + i) & MASK];
+        }
+
+        storeTail(static_cast<Index>(tail + n));
+        return n;
+    }
+
+    // Exact from either side for the side's own view; a snapshot otherwise
+    size_t size() const { return static_cast<Index>(loadHead() - loadTail()); }
+    bool empty() const { return size() == 0; }
+    static constexpr size_t capacity() { return N; }
+
+    uint32_t dropped() const { return _dropped; }
+};
+
+#endif // SPSC_RING_H
@@ -0,0 +1,135 @@
+#ifndef STAGE_VALUE_BUFFER_H
+#define STAGE_VALUE_BUFFER_H
+
+#include <Arduino.h>
+
+#if !defined(__AVR__)
+#include <atomic>
+#endif
+
+// Consistent copy of all stage values of a sensor at one point in time.
+template <uint8_t N, typename T = float>
+struct StageSnapshot
+{
+    T value[N];
+
+    T operator[](uint8_t idx) const { return value[idx]; }
+    static constexpr uint8_t size() { return N; }
+};
+
+/**
+ * Double-buffered stage values with a publish counter (seqlock style).
+ *
+ * The single writer fills the back buffer and publishes it by incrementing
+ * the counter; readers copy the front buffer and retry if a publish
+ * completed during their copy. Readers never block the writer.
+ *
+ * The back buffer is the front buffer of the previous publish, which slow
+ * readers may still be copying. beginWrite() therefore issues a release
+ * fence before its first store: the counter increment of the last publish
+ * becomes visible no later than the new data, and a reader that saw any of
+ * it also sees the changed counter and retries.
+ *
+ * Writers must be serialised externally (SensorLock or a single producer).
+ *
+ * T is float for the float pipelines and int32_t for FixedSensor. AVR has no
+ * <atomic>; there the counter is a single byte (atomic to load and store on
+ * an 8-bit core) and a compiler barrier replaces the fences.
+ */
+template <uint8_t N, typename T = float>
+class StageValueBuffer
+{
+private:
+    T _buf[2][N];
+
+#if defined(__AVR__)
+    volatile uint8_t _seq; // Number of publishes (mod 256); (seq & 1) selects the front buffer
+
+    inline uint8_t loadSeq() const { return _seq; }
+    inline void storeSeq(uint8_t seq) { __asm__ __volatile__("" ::: "memory"); _seq = seq; }
+    static inline void readFence() { __asm__ __volatile__("" ::: "memory"); }
+    static inline void writeFence() { __asm__ __volatile__("" ::: "memory"); }
+#else
+    std::atomic<uint32_t> _seq; // Number of publishes; (seq & 1) selects the front buffer
+
+    inline uint32_t loadSeq() const { return _seq.load(std::memory_order_acquire); }
+    inline void storeSeq(uint32_t seq) { _seq.store(seq, std::memory_order_release); }
+    static inline void readFence() { std::atomic_thread_fence(std::memory_order_acquire); }
+    static inline void writeFence() { std::atomic_thread_fence(std::memory_order_release); }
+#endif
+
+public:
+    StageValueBuffer() : _seq(0)
+    {
+        for (uint8_t i = 0; i < N; i++)
+        {
+            _buf[0][i] = T(0);
+            _buf[1][i] = T(0);
+        }
+    }
+
+    StageValueBuffer(const StageValueBuffer &) = delete;
+    StageValueBuffer &operator=(const StageValueBuffer &) = delete;
+
+    // Writer: returns the back buffer, pre-loaded with the current values so
+    // stages that do not update this cycle keep their last value.
+    inline T *beginWrite()
+    {
+        const uint32_t seq = loadSeq();
+        T *back = _buf[(seq + 1) & 1];
+        const T *front = _buf[seq & 1];
+
+        // Order the last publish before any store into the reused buffer
+        writeFence();
+
+        for (uint8_t i = 0; i < N; i++)
+        {
+            back[i] = front[i];
+        }
+
+        return back;
+    }
+
+    // Writer: makes the back buffer visible to readers
+    inline void publish()
+    {
+        storeSeq(loadSeq() + 1);
+    }
+
+    T read(uint8_t idx) const
+    {
+        uint32_t seq;
+        T value;
+
+        do
+        {
+            seq = loadSeq();
+            value = _buf[seq & 1][idx];
+            readFence();
+        } while (loadSeq() != seq);
+
+        return value;
+    }
+
+    StageSnapshot<N, T> snapshot() const
+    {
+        StageSnapshot<N, T> s;
+        uint32_t seq;
+
+        do
+        {
+            seq = loadSeq();
+
+            for (uint8_t i = 0; i < N; i++)
+            {
+                s.value[i] = _buf[seq & 1][i];
+            }
+
+            readFence();
+        } while (loadSeq() != seq);
+
+        return s;
+    }
+};
+
+#endif // STAGE_VALUE_BUFFER_H
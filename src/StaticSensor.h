@@ -0,0 +1,196 @@
+#ifndef STATIC_SENSOR_H
+#define STATIC_SENSOR_H
+
+#include "BaseMeasurementProcessor.h"
+#include "SensorLock.h"
+#include "StageValueBuffer.h"
+
+/**
+ * Compile-time processing chain used by StaticSensor.
+ *
+ * Stages are stored by value and invoked with qualified calls
+ * (head.Head::apply), so there is no virtual dispatch and no empty-slot
+ * check; the compiler sees every stage body and can inline the whole chain.
+ */
+template <class... Stages>
+struct StaticStageChain;
+
+template <>
+struct StaticStageChain<>
+{
+    inline bool apply(float, float *) { return true; }
+    inline size_t applyBlock(const float *, float *, size_t n, float *) { return n; }
+};
+
+template <class Head, class... Tail>
+struct StaticStageChain<Head, Tail...>
+{
+    Head head;
+    StaticStageChain<Tail...> tail;
+
+    StaticStageChain() {}
+    StaticStageChain(const Head &h, const Tail &...t) : head(h), tail(t...) {}
+
+    // False if a decimating stage withheld its output (rest of the chain skipped)
+    inline bool apply(float value, float *stage)
+    {
+        float out = head.Head::apply(value);
+
+        if (!head.outputReady())
+        {
+            return false;
+        }
+
+        stage[0] = out;
+        return tail.apply(out, stage + 1);
+    }
+
+    // in -> buf for this stage, in place on buf for all following stages
+    inline size_t applyBlock(const float *in, float *buf, size_t n, float *stage)
+    {
+        n = head.Head::applyBlock(in, buf, n);
+
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        stage[0] = buf[n - 1];
+        return tail.applyBlock(buf, buf, n, stage + 1);
+    }
+};
+
+// Type and reference of the I-th stage of a StaticStageChain
+template <size_t I, class Chain>
+struct StaticStageAt;
+
+template <class Head, class... Tail>
+struct StaticStageAt<0, StaticStageChain<Head, Tail...>>
+{
+    typedef Head type;
+    static Head &get(StaticStageChain<Head, Tail...> &chain) { return chain.head; }
+};
+
+template <size_t I, class Head, class... Tail>
+struct StaticStageAt<I, StaticStageChain<Head, Tail...>>
+{
+    typedef typename StaticStageAt<I - 1, StaticStageChain<Tail...>>::type type;
+    static type &get(StaticStageChain<Head, Tail...> &chain) { return StaticStageAt<I - 1, StaticStageChain<Tail...>>::get(chain.tail); }
+};
+
+/**
+ * GenericSensor counterpart with the pipeline fixed at compile time:
+ *
+ *     StaticSensor<RTD385, Median3Filter, EMAFilter> s(RTD385(100.0f), Median3Filter(), EMAFilter(0.1f));
+ *     s.push(R);
+ *     float T = s.getReading();
+ *     s.stage<2>().setAlpha(0.05f);
+ *
+ * Provides the same push/pushBlock/getReading/getProcessStagesValues API and
+ * the same locking semantics as GenericSensor.
+ */
+template <class... Stages>
+class StaticSensor
+{
+    static_assert(sizeof...(Stages) > 0, "StaticSensor needs at least one stage");
+
+public:
+    static const uint8_t NUM_PROCESSORS = sizeof...(Stages);
+
+    typedef StageSnapshot<NUM_PROCESSORS + 1> StageValues;
+    typedef StaticStageChain<Stages...> Chain;
+
+private:
+    static const uint8_t BLOCK_SIZE = 32; // Samples per pushBlock() chunk (stack scratch buffer)
+
+    SensorLock _lock;
+    StageValueBuffer<NUM_PROCESSORS + 1> processStageValue;
+    Chain _chain;
+
+public:
+    explicit StaticSensor(PushMode mode = PushMode::LOCKED) : _lock(mode) {}
+
+    explicit StaticSensor(const Stages &...stages) : _lock(PushMode::LOCKED), _chain(stages...) {}
+
+    StaticSensor(PushMode mode, const Stages &...stages) : _lock(mode), _chain(stages...) {}
+
+    ~StaticSensor() {}
+
+    StaticSensor(const StaticSensor &) = delete;
+    StaticSensor &operator=(const StaticSensor &) = delete;
+
+    // Direct access to a stage for configuration (not synchronised with push())
+    template <size_t I>
+    typename StaticStageAt<I, Chain>::type &stage()
+    {
+        return StaticStageAt<I, Chain>::get(_chain);
+    }
+
+    float getReading() const
+    {
+        return processStageValue.read(NUM_PROCESSORS);
+    }
+
+    StageValues getProcessStagesValues() const
+    {
+        return processStageValue.snapshot();
+    }
+
+    PushMode getPushMode() const { return _lock.mode(); }
+
+    void push(uint32_t x) { push(static_cast<float>(x)); }
+    void push(uint16_t x) { push(static_cast<float>(x)); }
+    void push(int32_t x) { push(static_cast<float>(x)); }
+
+    void push(float startValue)
+    {
+        if (_lock.take())
+        {
+            float *stage = processStageValue.beginWrite();
+
+            stage[0] = startValue;
+
+            if (_chain.apply(startValue, stage + 1))
+            {
+                processStageValue.publish();
+            }
+
+            _lock.give();
+        }
+    }
+
+    void pushBlock(const float *samples, size_t n)
+    {
+        if (n == 0)
+        {
+            return;
+        }
+
+        if (_lock.take())
+        {
+            float *stage = processStageValue.beginWrite();
+            float block[BLOCK_SIZE];
+            bool emitted = false;
+
+            while (n > 0)
+            {
+                size_t count = (n < BLOCK_SIZE) ? n : BLOCK_SIZE;
+
+                stage[0] = samples[count - 1];
+                emitted |= _chain.applyBlock(samples, block, count, stage + 1) > 0;
+
+                samples += count;
+                n -= count;
+            }
+
+            if (emitted)
+            {
+                processStageValue.publish();
+            }
+
+            _lock.give();
+        }
+    }
+};
+
+#endif // STATIC_SENSOR_H